@@ -18,6 +18,7 @@
 #include "std_dds_utils.h"
 #include "array_list.h"
 
+#include <stdint.h>
 #include <stdio.h>
 
 void PrintIntArrayList(ArrayList *list) {
@@ -41,6 +42,9 @@ void PrintIntArrayList(ArrayList *list) {
     printf("]\n");
 }
 
+int IsGreaterThan(void *value, void *ctx) {
+    return *(int *)value > *(int *)ctx;
+}
 
 int main(void){
     STD_DDS_RESULT result;
@@ -147,6 +151,18 @@ int main(void){
         return 1;
     }
     PrintIntArrayList(list);
+
+    printf("\n-- ArrayListSetGrowth() --\n");
+
+    ArrayListGrowth growth = { .factor = 1.5, .step = 2, .limit = 1024 };
+    printf("Setting ArrayList growth to a factor of '%.1f' plus '%zu' elements, linear from '%zu' elements.\n", growth.factor, growth.step, growth.limit);
+    result = ArrayListSetGrowth(list, growth);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to set ArrayList growth. Exiting.\n");
+        ArrayListFree(list);
+        return 1;
+    }
     
     printf("\n-- ArrayListInsertAt() --\n");
 
@@ -198,6 +214,31 @@ int main(void){
 
     PrintIntArrayList(list);
 
+    printf("\n-- ArrayListReserve() --\n");
+
+    size_t listReserveCapacity = 16;
+    printf("Reserving room for '%zu' elements in ArrayList.\n", listReserveCapacity);
+    result = ArrayListReserve(list, listReserveCapacity);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to reserve ArrayList capacity. Exiting.\n");
+        ArrayListFree(list);
+        return 1;
+    }
+    PrintIntArrayList(list);
+
+    printf("\n-- ArrayListShrinkToFit() --\n");
+
+    printf("Shrinking ArrayList capacity to its length of '%zu'.\n", ArrayListGetLength(list));
+    result = ArrayListShrinkToFit(list);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to shrink ArrayList. Exiting.\n");
+        ArrayListFree(list);
+        return 1;
+    }
+    PrintIntArrayList(list);
+
     printf("\n-- ArrayListGetAt() --\n");
 
     printf("Getting ArrayList elements of by index.\n");
@@ -213,10 +254,168 @@ int main(void){
 
     }
 
+    printf("\n-- ArrayListIndexOf() --\n");
+
+    printf("Finding the element pointing to '%d' in ArrayList.\n", g);
+    size_t foundIndex = ArrayListIndexOf(list, &g);
+    if(foundIndex == (size_t)-1){
+        printf("Unable to find '%d' in ArrayList. Exiting.\n", g);
+        ArrayListFree(list);
+        return 1;
+    }
+    printf("'%d' found at index [%zu].\n", g, foundIndex);
+
+    printf("\n-- ArrayListCount() --\n");
+
+    printf("Counting the elements pointing to '%d' in ArrayList.\n", g);
+    printf("'%d' found '%zu' time(s).\n", g, ArrayListCount(list, &g));
+
+    printf("\n-- ArrayListRemoveIf() --\n");
+
+    int threshold = 7;
+    printf("Removing every element greater than '%d' from ArrayList.\n", threshold);
+    size_t removed = ArrayListRemoveIf(list, IsGreaterThan, &threshold);
+    if(removed == (size_t)-1){
+        printf("Failed to remove elements from ArrayList. Exiting.\n");
+        ArrayListFree(list);
+        return 1;
+    }
+    printf("'%zu' elements removed from ArrayList.\n", removed);
+    PrintIntArrayList(list);
+
     printf("\n-- ArrayListFree() --\n");
 
     printf("Freeing ArrayList.\n");
     ArrayListFree(list);
 
+    printf("\n-- ArrayListInitFromArray() --\n");
+
+    void *initValues[] = {&a, &b, &c};
+    printf("Initialising an ArrayList from an array of '%d', '%d' and '%d'.\n", a, b, c);
+    ArrayList *arrayList = ArrayListInitFromArray(initValues, 3);
+    if(arrayList == NULL){
+        printf("Failed to initialise ArrayList. Exiting.\n");
+        return 1;
+    }
+    PrintIntArrayList(arrayList);
+
+    printf("\n-- ArrayListAppendArray() --\n");
+
+    void *appendValues[] = {&d, &e};
+    printf("Appending an array of '%d' and '%d' to ArrayList.\n", d, e);
+    result = ArrayListAppendArray(arrayList, appendValues, 2);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to append to ArrayList. Exiting.\n");
+        ArrayListFree(arrayList);
+        return 1;
+    }
+    PrintIntArrayList(arrayList);
+
+    printf("\n-- ArrayListFillPattern() --\n");
+
+    void *pattern[] = {&f, &g};
+    printf("Filling ArrayList with a repeating pattern of '%d' and '%d'.\n", f, g);
+    result = ArrayListFillPattern(arrayList, pattern, 2);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to fill ArrayList. Exiting.\n");
+        ArrayListFree(arrayList);
+        return 1;
+    }
+    PrintIntArrayList(arrayList);
+
+    printf("\n-- ArrayListFill() --\n");
+
+    printf("Filling ArrayList with '%d'.\n", h);
+    result = ArrayListFill(arrayList, &h);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to fill ArrayList. Exiting.\n");
+        ArrayListFree(arrayList);
+        return 1;
+    }
+    PrintIntArrayList(arrayList);
+
+    printf("Freeing ArrayList.\n");
+    ArrayListFree(arrayList);
+
+    printf("\n-- ArrayListOpenMapped() --\n");
+
+    const char *mappedPath = "e_array_list.bin";
+    printf("Opening a file-backed ArrayList at '%s'.\n", mappedPath);
+    ArrayList *mappedList = ArrayListOpenMapped(mappedPath);
+    if(mappedList == NULL){
+        printf("Failed to open file-backed ArrayList. Skipping.\n");
+    } else {
+        printf("Appending the indices '0' to '4' to ArrayList.\n");
+        for(uintptr_t i = 0; i < 5; i++){
+            result = ArrayListAppend(mappedList, (void *)i);
+            if(result != STD_DDS_SUCCESS){
+                PrintResultCode(result);
+                printf("Failed to append to ArrayList. Exiting.\n");
+                ArrayListFree(mappedList);
+                remove(mappedPath);
+                return 1;
+            }
+        }
+
+        printf("\n-- ArrayListSync() --\n");
+
+        printf("Syncing ArrayList to '%s'.\n", mappedPath);
+        result = ArrayListSync(mappedList);
+        if(result != STD_DDS_SUCCESS){
+            PrintResultCode(result);
+            printf("Failed to sync ArrayList. Exiting.\n");
+            ArrayListFree(mappedList);
+            remove(mappedPath);
+            return 1;
+        }
+
+        printf("Closing and reopening ArrayList.\n");
+        ArrayListFree(mappedList);
+        mappedList = ArrayListOpenMapped(mappedPath);
+        if(mappedList == NULL){
+            printf("Failed to reopen file-backed ArrayList. Exiting.\n");
+            remove(mappedPath);
+            return 1;
+        }
+
+        printf("Result: [");
+        for(size_t i = 0; i < ArrayListGetLength(mappedList); i++){
+            printf("%zu", (size_t)(uintptr_t)ArrayListGetAt(mappedList, i));
+            if(i < ArrayListGetLength(mappedList) - 1){
+                printf(", ");
+            }
+        }
+        printf("]\n");
+
+        ArrayListFree(mappedList);
+        remove(mappedPath);
+    }
+
+    printf("\n-- ArrayListInitInline() --\n");
+
+    size_t inlineCapacity = 2;
+    printf("Initialising an ArrayList with '%zu' elements stored inline.\n", inlineCapacity);
+    ArrayList *inlineList = ArrayListInitInline(inlineCapacity);
+    if(inlineList == NULL){
+        printf("Failed to initialise ArrayList. Exiting.\n");
+        return 1;
+    }
+
+    printf("Appending '%d', '%d' and '%d' to ArrayList, spilling past its inline elements.\n", a, b, c);
+    if(ArrayListAppend(inlineList, &a) != STD_DDS_SUCCESS ||
+       ArrayListAppend(inlineList, &b) != STD_DDS_SUCCESS ||
+       ArrayListAppend(inlineList, &c) != STD_DDS_SUCCESS){
+        printf("Failed to append to ArrayList. Exiting.\n");
+        ArrayListFree(inlineList);
+        return 1;
+    }
+    PrintIntArrayList(inlineList);
+
+    printf("Freeing ArrayList.\n");
+    ArrayListFree(inlineList);
+
     return 0;
 }
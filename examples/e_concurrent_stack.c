@@ -0,0 +1,96 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "std_dds_core.h"
+#include "std_dds_utils.h"
+#include "concurrent_stack.h"
+#include "epoch.h"
+
+#include <stdio.h>
+
+int main(void){
+    STD_DDS_RESULT result;
+
+    printf("\n== std_dds ConcurrentStack Example ==\n");
+
+    printf("\n-- ConcurrentStackInit() --\n");
+
+    printf("Initialising a ConcurrentStack.\n");
+    ConcurrentStack *stack = ConcurrentStackInit();
+    if(stack == NULL){
+        printf("Failed to initialise ConcurrentStack. Exiting.\n");
+        return 1;
+    }
+
+    printf("\n-- ConcurrentStackPush() --\n");
+
+    char a = 'a';
+    printf("Pushing '%c' onto ConcurrentStack.\n", a);
+    result = ConcurrentStackPush(stack, &a);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to push onto ConcurrentStack. Exiting.\n");
+        ConcurrentStackFree(stack);
+        return 1;
+    }
+
+    printf("\n-- ConcurrentStackPushN() --\n");
+
+    char letters[] = "bcd";
+    void *values[3] = {&letters[0], &letters[1], &letters[2]};
+    printf("Pushing '%s' onto ConcurrentStack in one atomic update.\n", letters);
+    result = ConcurrentStackPushN(stack, values, 3);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to push onto ConcurrentStack. Exiting.\n");
+        ConcurrentStackFree(stack);
+        return 1;
+    }
+
+    printf("ConcurrentStack length: %zu\n", ConcurrentStackGetLength(stack));
+
+    printf("\n-- ConcurrentStackPeek() --\n");
+
+    char *value = (char *)ConcurrentStackPeek(stack);
+    if(value == NULL){
+        printf("Failed to peek ConcurrentStack. Exiting.\n");
+        ConcurrentStackFree(stack);
+        return 1;
+    }
+
+    printf("'%c' is on top of the ConcurrentStack.\n", *value);
+
+    printf("\n-- ConcurrentStackPop() --\n");
+
+    while((value = (char *)ConcurrentStackPop(stack)) != NULL){
+        printf("'%c' popped from ConcurrentStack successfully.\n", *value);
+    }
+
+    printf("\n-- ConcurrentStackFree() --\n");
+
+    printf("Freeing ConcurrentStack and draining retired nodes.\n");
+    result = ConcurrentStackFree(stack);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to free ConcurrentStack. Exiting.\n");
+        return 1;
+    }
+
+    EpochDrain();
+
+    return 0;
+}
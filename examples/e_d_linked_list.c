@@ -19,6 +19,7 @@
 #include "std_dds_core.h"
 
 #include <stdio.h>
+#include <string.h>
 
 void PrintStrDLinkedList(DLinkedList *list){
     printf("Result: [");
@@ -50,6 +51,10 @@ void PrintStrDLinkedListRev(DLinkedList *list){
     printf("]\n");
 }
 
+int CompareStr(const void *a, const void *b){
+    return strcmp((const char *)a, (const char *)b);
+}
+
 int main(void){
     STD_DDS_RESULT result;
 
@@ -156,6 +161,84 @@ int main(void){
     PrintStrDLinkedList(list);
     PrintStrDLinkedListRev(list);
 
+    printf("\n-- DLinkedListInsertAfter() --\n");
+
+    char g[] = "short";
+    DLinkedNode *node = DLinkedListGetHead(list)->next->next;
+    printf("Inserting '%s' after '%s'.\n", g, (char *)node->value);
+    DLinkedNode *inserted = DLinkedListInsertAfter(list, node, &g);
+    if(inserted == NULL){
+        printf("Failed to insert into DLinkedList. Exiting.\n");
+        DLinkedListFree(list);
+        return 1;
+    }
+
+    PrintStrDLinkedList(list);
+
+    printf("\n-- DLinkedListUnlink() --\n");
+
+    value = DLinkedListUnlink(list, inserted);
+    printf("'%s' unlinked from the DLinkedList.\n", (char *)value);
+
+    PrintStrDLinkedList(list);
+
+    printf("\n-- DLinkedListSplice() --\n");
+
+    DLinkedList *other = DLinkedListInit();
+    if(other == NULL){
+        printf("Failed to initialise DLinkedList. Exiting.\n");
+        DLinkedListFree(list);
+        return 1;
+    }
+
+    char h[] = "with";
+    char i[] = "more";
+    char j[] = "nodes";
+    DLinkedListAppend(other, &h);
+    DLinkedListAppend(other, &i);
+    DLinkedListAppend(other, &j);
+
+    printf("Splicing a second DLinkedList onto the tail of the DLinkedList.\n");
+    result = DLinkedListSplice(list, other);
+    if(result != STD_DDS_SUCCESS){
+        printf("Failed to splice DLinkedLists. Exiting.\n");
+        DLinkedListFree(other);
+        DLinkedListFree(list);
+        return 1;
+    }
+
+    PrintStrDLinkedList(list);
+    printf("Second DLinkedList length after splicing: %zu\n", DLinkedListGetLength(other));
+    DLinkedListFree(other);
+
+    printf("\n-- DLinkedListSplitAt() --\n");
+
+    node = DLinkedListGetTail(list)->prev->prev;
+    printf("Splitting the DLinkedList at '%s'.\n", (char *)node->value);
+    other = DLinkedListSplitAt(list, node);
+    if(other == NULL){
+        printf("Failed to split DLinkedList. Exiting.\n");
+        DLinkedListFree(list);
+        return 1;
+    }
+
+    PrintStrDLinkedList(list);
+    PrintStrDLinkedList(other);
+    DLinkedListFree(other);
+
+    printf("\n-- DLinkedListSort() --\n");
+
+    printf("Sorting the DLinkedList in place.\n");
+    result = DLinkedListSort(list, CompareStr);
+    if(result != STD_DDS_SUCCESS){
+        printf("Failed to sort DLinkedList. Exiting.\n");
+        DLinkedListFree(list);
+        return 1;
+    }
+
+    PrintStrDLinkedList(list);
+    PrintStrDLinkedListRev(list);
+
     printf("\n-- DLinkedListFree() --\n");
     printf("Freeing DLinkedList.\n");
     result = DLinkedListFree(list);
@@ -0,0 +1,174 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "std_dds_utils.h"
+#include "gap_buffer.h"
+
+#include <stdio.h>
+
+void PrintCharGapBuffer(GapBuffer *buffer) {
+    printf("Result: \"");
+    for (size_t i = 0; i < GapBufferGetLength(buffer); i++) {
+        if (i == GapBufferGetCursor(buffer)) {
+            printf("|");
+        }
+
+        char *value = (char *)GapBufferGetAt(buffer, i);
+        if (value != NULL) {
+            printf("%c", *value);
+        }
+    }
+    if (GapBufferGetCursor(buffer) == GapBufferGetLength(buffer)) {
+        printf("|");
+    }
+    printf("\"\n");
+}
+
+int main(void){
+    STD_DDS_RESULT result;
+
+    printf("\n== std_dds GapBuffer Example ==\n");
+
+    printf("\n-- GapBufferInit() --\n");
+
+    size_t bufferCapacity = 4;
+    printf("Initialising a GapBuffer with a capacity of '%zu' elements.\n", bufferCapacity);
+    GapBuffer *buffer = GapBufferInit(bufferCapacity);
+    if(buffer == NULL){
+        printf("Failed to initialise GapBuffer. Exiting.\n");
+        return 1;
+    }
+    PrintCharGapBuffer(buffer);
+
+    printf("\n-- GapBufferInsert() --\n");
+
+    char text[] = "Helo wworld!?";
+    for(size_t i = 0; text[i] != '\0'; i++){
+        result = GapBufferInsert(buffer, &text[i]);
+        if(result != STD_DDS_SUCCESS){
+            PrintResultCode(result);
+            printf("Failed to insert into GapBuffer. Exiting.\n");
+            GapBufferFree(buffer);
+            return 1;
+        }
+    }
+    printf("Inserting \"%s\" at the cursor of the GapBuffer.\n", text);
+    PrintCharGapBuffer(buffer);
+
+    printf("\n-- GapBufferMoveCursor() --\n");
+
+    size_t cursor = 3;
+    printf("Moving the cursor of the GapBuffer to index [%zu].\n", cursor);
+    result = GapBufferMoveCursor(buffer, cursor);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to move the GapBuffer cursor. Exiting.\n");
+        GapBufferFree(buffer);
+        return 1;
+    }
+    PrintCharGapBuffer(buffer);
+
+    char a = 'l';
+    printf("Inserting '%c' at the cursor of the GapBuffer.\n", a);
+    result = GapBufferInsert(buffer, &a);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to insert into GapBuffer. Exiting.\n");
+        GapBufferFree(buffer);
+        return 1;
+    }
+    PrintCharGapBuffer(buffer);
+
+    printf("\n-- GapBufferRemoveAt() --\n");
+
+    size_t removeIndex = 6;
+    printf("Removing element at index [%zu] from the GapBuffer.\n", removeIndex);
+    void *value = GapBufferRemoveAt(buffer, removeIndex);
+    if(value == NULL){
+        printf("Removing element at index [%zu] was unsuccessful. Exiting.\n", removeIndex);
+        GapBufferFree(buffer);
+        return 1;
+    }
+    printf("'%c' removed from the GapBuffer successfully.\n", *(char *)value);
+    PrintCharGapBuffer(buffer);
+
+    printf("\n-- GapBufferInsertAt() --\n");
+
+    char b = ',';
+    size_t insertIndex = 5;
+    printf("Inserting '%c' at index [%zu] of the GapBuffer.\n", b, insertIndex);
+    result = GapBufferInsertAt(buffer, insertIndex, &b);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to insert into GapBuffer. Exiting.\n");
+        GapBufferFree(buffer);
+        return 1;
+    }
+    PrintCharGapBuffer(buffer);
+
+    printf("\n-- GapBufferRemove() --\n");
+
+    cursor = GapBufferGetLength(buffer) - 1;
+    printf("Moving the cursor of the GapBuffer to index [%zu].\n", cursor);
+    result = GapBufferMoveCursor(buffer, cursor);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to move the GapBuffer cursor. Exiting.\n");
+        GapBufferFree(buffer);
+        return 1;
+    }
+
+    printf("Removing the element after the cursor of the GapBuffer.\n");
+    value = GapBufferRemove(buffer);
+    if(value == NULL){
+        printf("Removing the element after the cursor was unsuccessful. Exiting.\n");
+        GapBufferFree(buffer);
+        return 1;
+    }
+    printf("'%c' removed from the GapBuffer successfully.\n", *(char *)value);
+    PrintCharGapBuffer(buffer);
+
+    printf("\n-- GapBufferRemoveBefore() --\n");
+
+    printf("Removing the element before the cursor of the GapBuffer.\n");
+    value = GapBufferRemoveBefore(buffer);
+    if(value == NULL){
+        printf("Removing the element before the cursor was unsuccessful. Exiting.\n");
+        GapBufferFree(buffer);
+        return 1;
+    }
+    printf("'%c' removed from the GapBuffer successfully.\n", *(char *)value);
+    PrintCharGapBuffer(buffer);
+
+    char c = '.';
+    printf("Inserting '%c' at the cursor of the GapBuffer.\n", c);
+    result = GapBufferInsert(buffer, &c);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to insert into GapBuffer. Exiting.\n");
+        GapBufferFree(buffer);
+        return 1;
+    }
+    PrintCharGapBuffer(buffer);
+
+    printf("\n-- GapBufferFree() --\n");
+
+    printf("Freeing GapBuffer.\n");
+    GapBufferFree(buffer);
+
+    return 0;
+}
@@ -0,0 +1,112 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "std_dds_core.h"
+#include "std_dds_utils.h"
+#include "intrusive_list.h"
+
+#include <stdio.h>
+
+typedef struct session {
+    int id;
+    DLinkedHook lruHook;
+    DLinkedHook timeoutHook;
+} Session;
+
+void PrintLruList(IntrusiveList *list){
+    printf("LRU: [");
+    STD_DDS_INTRUSIVE_LIST_FOR_EACH(list, hook){
+        Session *session = STD_DDS_INTRUSIVE_LIST_ENTRY(hook, Session, lruHook);
+        printf("%d%s", session->id, hook->next != NULL ? "->" : "");
+    }
+    printf("]\n");
+}
+
+void PrintTimeoutList(IntrusiveList *list){
+    printf("Timeout: [");
+    STD_DDS_INTRUSIVE_LIST_FOR_EACH(list, hook){
+        Session *session = STD_DDS_INTRUSIVE_LIST_ENTRY(hook, Session, timeoutHook);
+        printf("%d%s", session->id, hook->next != NULL ? "->" : "");
+    }
+    printf("]\n");
+}
+
+int main(void){
+    STD_DDS_RESULT result;
+
+    printf("\n== std_dds IntrusiveList Example ==\n");
+
+    printf("\n-- IntrusiveListInit() --\n");
+
+    printf("Initialising an LRU IntrusiveList and a timeout IntrusiveList.\n");
+    IntrusiveList lru;
+    IntrusiveList timeouts = {0};
+    result = IntrusiveListInit(&lru);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to initialise IntrusiveList. Exiting.\n");
+        return 1;
+    }
+
+    Session sessions[4] = {{.id = 1}, {.id = 2}, {.id = 3}, {.id = 4}};
+
+    printf("\n-- IntrusiveListPush() / IntrusiveListAppend() --\n");
+
+    printf("Linking each Session into both lists without allocating.\n");
+    for(int i = 0; i < 4; i++){
+        IntrusiveListPush(&lru, &sessions[i].lruHook);
+        IntrusiveListAppend(&timeouts, &sessions[i].timeoutHook);
+    }
+
+    PrintLruList(&lru);
+    PrintTimeoutList(&timeouts);
+
+    printf("\n-- IntrusiveListRemove() --\n");
+
+    printf("Session 2 was used, moving it to the head of the LRU list.\n");
+    result = IntrusiveListRemove(&lru, &sessions[1].lruHook);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to remove from IntrusiveList. Exiting.\n");
+        return 1;
+    }
+    IntrusiveListPush(&lru, &sessions[1].lruHook);
+
+    PrintLruList(&lru);
+    PrintTimeoutList(&timeouts);
+
+    printf("\n-- IntrusiveListPopTail() --\n");
+
+    DLinkedHook *hook = IntrusiveListPopTail(&lru);
+    if(hook == NULL){
+        printf("Popping the tail of the LRU list was unsuccessful. Exiting.\n");
+        return 1;
+    }
+
+    Session *evicted = STD_DDS_INTRUSIVE_LIST_ENTRY(hook, Session, lruHook);
+    printf("Evicting least recently used Session %d from both lists.\n", evicted->id);
+    IntrusiveListRemove(&timeouts, &evicted->timeoutHook);
+
+    PrintLruList(&lru);
+    PrintTimeoutList(&timeouts);
+
+    printf("\n-- IntrusiveListGetLength() --\n");
+
+    printf("LRU length: %zu, Timeout length: %zu\n", IntrusiveListGetLength(&lru), IntrusiveListGetLength(&timeouts));
+
+    return 0;
+}
@@ -36,6 +36,10 @@ void PrintCharLinkedList(LinkedList *list){
     printf("]\n");
 }
 
+int CompareChar(const void *a, const void *b){
+    return *(const char *)a - *(const char *)b;
+}
+
 int main(void){
     STD_DDS_RESULT result;
 
@@ -165,5 +169,82 @@ int main(void){
         return 1;
     }
 
+    printf("\n-- LinkedListInitBackLinked() --\n");
+
+    printf("Initialising back-linked LinkedList.\n");
+    list = LinkedListInitBackLinked();
+    if(list == NULL){
+        printf("Failed to initialise back-linked LinkedList. Exiting.\n");
+        return 1;
+    }
+
+    char letters[] = "retry";
+    printf("Appending the characters of \"%s\" onto the tail of the LinkedList.\n", letters);
+    for(size_t i = 0; letters[i] != '\0'; i++){
+        result = LinkedListAppend(list, &letters[i]);
+        if(result != STD_DDS_SUCCESS){
+            PrintResultCode(result);
+            printf("Failed to append LinkedList. Exiting.\n");
+            LinkedListFree(list);
+            return 1;
+        }
+    }
+
+    PrintCharLinkedList(list);
+
+    printf("\n-- LinkedListSort() --\n");
+
+    printf("Sorting the LinkedList in place.\n");
+    result = LinkedListSort(list, CompareChar);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to sort LinkedList. Exiting.\n");
+        LinkedListFree(list);
+        return 1;
+    }
+
+    PrintCharLinkedList(list);
+
+    printf("\n-- LinkedListPopTail() --\n");
+
+    printf("Popping the tail element from the LinkedList without traversing it.\n");
+    value = LinkedListPopTail(list);
+    if(value == NULL) {
+        printf("Popping the tail element from the LinkedList was unsuccessful. Exiting.\n");
+        LinkedListFree(list);
+        return 1;
+    }
+
+    printf("'%c' removed from the tail of the LinkedList successfully.\n", *(char *)value);
+
+    PrintCharLinkedList(list);
+
+    printf("\n-- LinkedListPopTailN() --\n");
+
+    void *popped[3];
+    printf("Popping 3 elements from the tail of the LinkedList.\n");
+    size_t poppedCount = LinkedListPopTailN(list, popped, 3);
+    if(poppedCount == (size_t)-1){
+        printf("Popping the tail elements from the LinkedList was unsuccessful. Exiting.\n");
+        LinkedListFree(list);
+        return 1;
+    }
+
+    printf("%zu elements removed from the tail of the LinkedList: [", poppedCount);
+    for(size_t i = 0; i < poppedCount; i++){
+        printf("%c%s", *(char *)popped[i], i + 1 < poppedCount ? ", " : "");
+    }
+    printf("]\n");
+
+    PrintCharLinkedList(list);
+
+    printf("Freeing back-linked LinkedList.\n");
+    result = LinkedListFree(list);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to free LinkedList. Exiting.\n");
+        return 1;
+    }
+
     return 0;
 }
@@ -0,0 +1,127 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "std_dds_core.h"
+#include "std_dds_utils.h"
+#include "mpmc_queue.h"
+
+#include <stdio.h>
+#include <pthread.h>
+
+#define WORKER_COUNT 3
+#define JOB_COUNT 12
+
+static void *worker(void *arg){
+    MPMCQueue *jobs = (MPMCQueue *)arg;
+    long total = 0;
+
+    for(;;){
+        int *job = (int *)MPMCQueueDequeue(jobs);
+        if(*job < 0){
+            break;
+        }
+        total += *job;
+    }
+
+    return (void *)total;
+}
+
+int main(void){
+    STD_DDS_RESULT result;
+
+    printf("\n== std_dds MPMCQueue Example ==\n");
+
+    printf("\n-- MPMCQueueInit() --\n");
+
+    printf("Initialising an MPMCQueue with a capacity of 4 elements.\n");
+    MPMCQueue *jobs = MPMCQueueInit(4);
+    if(jobs == NULL){
+        printf("Failed to initialise MPMCQueue. Exiting.\n");
+        return 1;
+    }
+
+    printf("\n-- MPMCQueueTryEnqueue() --\n");
+
+    int numbers[JOB_COUNT];
+    for(int i = 0; i < JOB_COUNT; i++){
+        numbers[i] = i + 1;
+    }
+
+    int enqueued = 0;
+    while((result = MPMCQueueTryEnqueue(jobs, &numbers[enqueued])) == STD_DDS_SUCCESS){
+        enqueued++;
+    }
+
+    printf("%d elements enqueued before the MPMCQueue filled up: ", enqueued);
+    PrintResultCode(result);
+
+    printf("\n-- MPMCQueueTryDequeue() --\n");
+
+    int *value = (int *)MPMCQueueTryDequeue(jobs);
+    printf("'%d' dequeued from MPMCQueue successfully.\n", *value);
+
+    result = MPMCQueueTryEnqueue(jobs, value);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to enqueue into MPMCQueue. Exiting.\n");
+        MPMCQueueFree(jobs);
+        return 1;
+    }
+    printf("'%d' enqueued back into the MPMCQueue of length %zu.\n", *value, MPMCQueueGetLength(jobs));
+
+    printf("\n-- MPMCQueueEnqueue() / MPMCQueueDequeue() --\n");
+
+    printf("Starting %d workers that sum jobs from the MPMCQueue.\n", WORKER_COUNT);
+    pthread_t workers[WORKER_COUNT];
+    for(int i = 0; i < WORKER_COUNT; i++){
+        if(pthread_create(&workers[i], NULL, worker, jobs) != 0){
+            printf("Failed to start worker. Exiting.\n");
+            return 1;
+        }
+    }
+
+    printf("Enqueuing the remaining %d jobs, waiting whenever the MPMCQueue is full.\n", JOB_COUNT - enqueued);
+    for(int i = enqueued; i < JOB_COUNT; i++){
+        MPMCQueueEnqueue(jobs, &numbers[i]);
+    }
+
+    int stop = -1;
+    for(int i = 0; i < WORKER_COUNT; i++){
+        MPMCQueueEnqueue(jobs, &stop);
+    }
+
+    long total = 0;
+    for(int i = 0; i < WORKER_COUNT; i++){
+        void *workerTotal;
+        pthread_join(workers[i], &workerTotal);
+        total += (long)workerTotal;
+    }
+
+    printf("Workers summed the jobs to %ld.\n", total);
+
+    printf("\n-- MPMCQueueFree() --\n");
+
+    printf("Freeing MPMCQueue.\n");
+    result = MPMCQueueFree(jobs);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to free MPMCQueue. Exiting.\n");
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,88 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "std_dds_core.h"
+#include "std_dds_utils.h"
+#include "mpsc_queue.h"
+
+#include <stdio.h>
+
+typedef struct message {
+    const char *sender;
+    int amount;
+    MPSCHook hook;
+} Message;
+
+int main(void){
+    STD_DDS_RESULT result;
+
+    printf("\n== std_dds MPSCQueue Example ==\n");
+
+    printf("\n-- MPSCQueueInit() --\n");
+
+    printf("Initialising an MPSCQueue as an actor's mailbox.\n");
+    MPSCQueue *mailbox = MPSCQueueInit();
+    if(mailbox == NULL){
+        printf("Failed to initialise MPSCQueue. Exiting.\n");
+        return 1;
+    }
+
+    printf("\n-- MPSCQueueEnqueue() --\n");
+
+    Message messages[] = {
+        {"alice", 10, {NULL}},
+        {"bob", 25, {NULL}},
+        {"carol", 5, {NULL}},
+    };
+
+    for(size_t i = 0; i < sizeof(messages) / sizeof(messages[0]); i++){
+        printf("Enqueue message from '%s' into MPSCQueue.\n", messages[i].sender);
+        result = MPSCQueueEnqueue(mailbox, &messages[i].hook);
+        if(result != STD_DDS_SUCCESS){
+            PrintResultCode(result);
+            printf("Failed to enqueue into MPSCQueue. Exiting.\n");
+            MPSCQueueFree(mailbox);
+            return 1;
+        }
+    }
+
+    printf("\n-- MPSCQueueDequeue() --\n");
+
+    int balance = 0;
+    while(!MPSCQueueIsEmpty(mailbox)){
+        MPSCHook *hook = MPSCQueueDequeue(mailbox);
+        if(hook == NULL){
+            continue;
+        }
+
+        Message *message = STD_DDS_MPSC_QUEUE_ENTRY(hook, Message, hook);
+        balance += message->amount;
+        printf("Received '%d' from '%s', balance is now '%d'.\n", message->amount, message->sender, balance);
+    }
+
+    printf("\n-- MPSCQueueFree() --\n");
+
+    printf("Freeing MPSCQueue.\n");
+    result = MPSCQueueFree(mailbox);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to free MPSCQueue. Exiting.\n");
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,138 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "std_dds_core.h"
+#include "std_dds_utils.h"
+#include "pairing_heap.h"
+
+#include <stdio.h>
+#include <limits.h>
+
+#define NODE_COUNT 5
+
+int main(void){
+    STD_DDS_RESULT result;
+
+    printf("\n== std_dds PairingHeap Example ==\n");
+
+    printf("\n-- PairingHeapInit() --\n");
+
+    printf("Initialising a PairingHeap for Dijkstra's algorithm.\n");
+    PairingHeap *heap = PairingHeapInit();
+    if(heap == NULL){
+        printf("Failed to initialise PairingHeap. Exiting.\n");
+        return 1;
+    }
+
+    printf("\n-- PairingHeapInsert() --\n");
+
+    char names[NODE_COUNT] = {'A', 'B', 'C', 'D', 'E'};
+    long long weights[NODE_COUNT][NODE_COUNT] = {
+        {0, 4, 1, 0, 0},
+        {0, 0, 0, 1, 0},
+        {0, 2, 0, 5, 0},
+        {0, 0, 0, 0, 3},
+        {0, 0, 0, 0, 0},
+    };
+
+    PairingHeapNode *handles[NODE_COUNT];
+    for(int i = 0; i < NODE_COUNT; i++){
+        handles[i] = PairingHeapInsert(heap, i == 0 ? 0 : LLONG_MAX, &names[i]);
+        if(handles[i] == NULL){
+            printf("Failed to insert into PairingHeap. Exiting.\n");
+            PairingHeapFree(heap);
+            return 1;
+        }
+    }
+
+    printf("Inserted %zu nodes, '%c' at distance 0.\n", PairingHeapGetLength(heap), names[0]);
+
+    printf("\n-- PairingHeapPop() / PairingHeapDecreaseKey() --\n");
+
+    long long distances[NODE_COUNT];
+    while(PairingHeapGetLength(heap) > 0){
+        long long distance;
+        char *name = (char *)PairingHeapPop(heap, &distance);
+        int from = (int)(name - names);
+
+        handles[from] = NULL;
+        distances[from] = distance;
+        printf("Visiting node '%c' at distance '%lld'.\n", *name, distance);
+
+        for(int to = 0; to < NODE_COUNT; to++){
+            if(weights[from][to] == 0 || handles[to] == NULL){
+                continue;
+            }
+
+            long long candidate = distance + weights[from][to];
+            if(candidate < handles[to]->key){
+                printf("  Decreasing distance of '%c' to '%lld'.\n", names[to], candidate);
+                PairingHeapDecreaseKey(heap, handles[to], candidate);
+            }
+        }
+    }
+
+    printf("Distance from '%c' to '%c' is '%lld'.\n", names[0], names[NODE_COUNT - 1], distances[NODE_COUNT - 1]);
+
+    printf("\n-- PairingHeapMeld() / PairingHeapRemove() --\n");
+
+    PairingHeap *other = PairingHeapInit();
+    if(other == NULL){
+        printf("Failed to initialise PairingHeap. Exiting.\n");
+        PairingHeapFree(heap);
+        return 1;
+    }
+
+    PairingHeapInsert(heap, 30, &names[0]);
+    PairingHeapInsert(heap, 10, &names[1]);
+    PairingHeapNode *removed = PairingHeapInsert(other, 5, &names[2]);
+    PairingHeapInsert(other, 20, &names[3]);
+
+    printf("Melding a PairingHeap of %zu nodes into one of %zu nodes.\n", PairingHeapGetLength(other), PairingHeapGetLength(heap));
+    result = PairingHeapMeld(heap, other);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to meld PairingHeaps. Exiting.\n");
+        PairingHeapFree(other);
+        PairingHeapFree(heap);
+        return 1;
+    }
+
+    printf("Removing node '%c' with key '%lld' through its handle.\n", *(char *)removed->value, removed->key);
+    PairingHeapRemove(heap, removed);
+
+    printf("Remaining in key order: [");
+    while(PairingHeapGetLength(heap) > 0){
+        long long key;
+        char *name = (char *)PairingHeapPop(heap, &key);
+        printf("%c:%lld%s", *name, key, PairingHeapGetLength(heap) > 0 ? ", " : "");
+    }
+    printf("]\n");
+
+    printf("\n-- PairingHeapFree() --\n");
+
+    printf("Freeing PairingHeaps.\n");
+    PairingHeapFree(other);
+    result = PairingHeapFree(heap);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to free PairingHeap. Exiting.\n");
+        return 1;
+    }
+
+    return 0;
+}
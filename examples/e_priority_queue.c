@@ -0,0 +1,156 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "std_dds_core.h"
+#include "std_dds_utils.h"
+#include "array_list.h"
+#include "priority_queue.h"
+
+#include <stdio.h>
+
+typedef struct task {
+    const char *name;
+    int deadline;
+} Task;
+
+int CompareTaskDeadline(const void *a, const void *b){
+    return ((const Task *)a)->deadline - ((const Task *)b)->deadline;
+}
+
+int main(void){
+    STD_DDS_RESULT result;
+
+    printf("\n== std_dds PriorityQueue Example ==\n");
+
+    printf("\n-- PriorityQueueInit() --\n");
+
+    printf("Initialising a 4-ary PriorityQueue of tasks ordered by deadline.\n");
+    PriorityQueue *tasks = PriorityQueueInit(0, CompareTaskDeadline);
+    if(tasks == NULL){
+        printf("Failed to initialise PriorityQueue. Exiting.\n");
+        return 1;
+    }
+
+    printf("\n-- PriorityQueuePush() --\n");
+
+    Task schedule[] = {
+        {"backup", 40},
+        {"email", 10},
+        {"report", 30},
+        {"deploy", 20},
+    };
+
+    for(size_t i = 0; i < sizeof(schedule) / sizeof(schedule[0]); i++){
+        printf("Push task '%s' with deadline '%d' onto PriorityQueue.\n", schedule[i].name, schedule[i].deadline);
+        result = PriorityQueuePush(tasks, &schedule[i]);
+        if(result != STD_DDS_SUCCESS){
+            PrintResultCode(result);
+            printf("Failed to push onto PriorityQueue. Exiting.\n");
+            PriorityQueueFree(tasks);
+            return 1;
+        }
+    }
+
+    printf("\n-- PriorityQueuePeek() --\n");
+
+    Task *task = (Task *)PriorityQueuePeek(tasks);
+    if(task == NULL){
+        printf("Failed to peek PriorityQueue. Exiting.\n");
+        PriorityQueueFree(tasks);
+        return 1;
+    }
+
+    printf("Task '%s' is due first.\n", task->name);
+
+    printf("\n-- PriorityQueuePop() --\n");
+
+    while((task = (Task *)PriorityQueuePop(tasks)) != NULL){
+        printf("Running task '%s' with deadline '%d'.\n", task->name, task->deadline);
+    }
+
+    printf("Freeing PriorityQueue.\n");
+    PriorityQueueFree(tasks);
+
+    printf("\n-- PriorityQueueInitFromArrayList() --\n");
+
+    ArrayList *list = ArrayListInit(4);
+    if(list == NULL){
+        printf("Failed to initialise ArrayList. Exiting.\n");
+        return 1;
+    }
+
+    for(size_t i = 0; i < sizeof(schedule) / sizeof(schedule[0]); i++){
+        ArrayListAppend(list, &schedule[i]);
+    }
+
+    printf("Heapifying an ArrayList of %zu tasks into a binary PriorityQueue.\n", ArrayListGetLength(list));
+    tasks = PriorityQueueInitFromArrayList(list, 2, CompareTaskDeadline);
+    ArrayListFree(list);
+    if(tasks == NULL){
+        printf("Failed to initialise PriorityQueue. Exiting.\n");
+        return 1;
+    }
+
+    task = (Task *)PriorityQueuePeek(tasks);
+    printf("Task '%s' is due first out of %zu tasks.\n", task->name, PriorityQueueGetLength(tasks));
+
+    printf("Freeing PriorityQueue.\n");
+    PriorityQueueFree(tasks);
+
+    printf("\n-- PriorityQueuePushKeyed() --\n");
+
+    printf("Initialising a keyed PriorityQueue.\n");
+    PriorityQueue *distances = PriorityQueueInit(0, NULL);
+    if(distances == NULL){
+        printf("Failed to initialise PriorityQueue. Exiting.\n");
+        return 1;
+    }
+
+    char nodes[] = "ABCD";
+    long long nodeDistances[] = {7, 0, 12, 3};
+
+    for(int i = 0; i < 4; i++){
+        printf("Push node '%c' with distance '%lld' onto PriorityQueue.\n", nodes[i], nodeDistances[i]);
+        result = PriorityQueuePushKeyed(distances, nodeDistances[i], &nodes[i]);
+        if(result != STD_DDS_SUCCESS){
+            PrintResultCode(result);
+            printf("Failed to push onto PriorityQueue. Exiting.\n");
+            PriorityQueueFree(distances);
+            return 1;
+        }
+    }
+
+    printf("\n-- PriorityQueuePopKeyed() --\n");
+
+    long long distance;
+    char *node;
+    while((node = (char *)PriorityQueuePopKeyed(distances, &distance)) != NULL){
+        printf("Visiting node '%c' at distance '%lld'.\n", *node, distance);
+    }
+
+    printf("\n-- PriorityQueueFree() --\n");
+
+    printf("Freeing PriorityQueue.\n");
+    result = PriorityQueueFree(distances);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to free PriorityQueue. Exiting.\n");
+        return 1;
+    }
+
+    return 0;
+}
@@ -109,5 +109,72 @@ int main(void){
         return 1;
     }
 
+    printf("\n-- QueueInitRing() --\n");
+
+    printf("Initialising a ring-backed Queue with a capacity of 4 elements.\n");
+    queue = QueueInitRing(4);
+    if(queue == NULL){
+        printf("Failed to initialise ring-backed Queue. Exiting.\n");
+        return 1;
+    }
+
+    printf("\n-- QueueEnqueueN() --\n");
+
+    int numbers[6] = {1, 2, 3, 4, 5, 6};
+    void *enqueued[6];
+    for(int i = 0; i < 6; i++){
+        enqueued[i] = &numbers[i];
+    }
+
+    printf("Enqueuing 3 elements into the Queue at once.\n");
+    result = QueueEnqueueN(queue, enqueued, 3);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to enqueue into ring-backed Queue. Exiting.\n");
+        QueueFree(queue);
+        return 1;
+    }
+
+    printf("'%d' dequeued from Queue successfully.\n", *(int *)QueueDequeue(queue));
+    printf("'%d' dequeued from Queue successfully.\n", *(int *)QueueDequeue(queue));
+
+    printf("Enqueuing 3 more elements, wrapping around the end of the Queue's array.\n");
+    result = QueueEnqueueN(queue, enqueued + 3, 3);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to enqueue into ring-backed Queue. Exiting.\n");
+        QueueFree(queue);
+        return 1;
+    }
+
+    printf("\n-- QueuePeek() --\n");
+
+    void *peeked = QueuePeek(queue);
+    if(peeked == NULL){
+        printf("Failed to peek ring-backed Queue. Exiting.\n");
+        QueueFree(queue);
+        return 1;
+    }
+
+    printf("'%d' is at the head of the Queue of length %zu.\n", *(int *)peeked, QueueGetLength(queue));
+
+    printf("\n-- QueueDequeueN() --\n");
+
+    void *dequeued[6];
+    size_t dequeuedCount = QueueDequeueN(queue, dequeued, 6);
+    printf("%zu elements dequeued from the Queue: [", dequeuedCount);
+    for(size_t i = 0; i < dequeuedCount; i++){
+        printf("%d%s", *(int *)dequeued[i], i + 1 < dequeuedCount ? ", " : "");
+    }
+    printf("]\n");
+
+    printf("Freeing ring-backed Queue.\n");
+    result = QueueFree(queue);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to free ring-backed Queue. Exiting.\n");
+        return 1;
+    }
+
     return 0;
 }
@@ -0,0 +1,88 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "std_dds_core.h"
+#include "std_dds_utils.h"
+#include "radix_heap.h"
+
+#include <stdio.h>
+
+int main(void){
+    STD_DDS_RESULT result;
+
+    printf("\n== std_dds RadixHeap Example ==\n");
+
+    printf("\n-- RadixHeapInit() --\n");
+
+    printf("Initialising a RadixHeap of timer expiry times.\n");
+    RadixHeap *heap = RadixHeapInit();
+    if(heap == NULL){
+        printf("Failed to initialise RadixHeap. Exiting.\n");
+        return 1;
+    }
+
+    printf("\n-- RadixHeapPush() --\n");
+
+    const char *timers[] = {"retry", "heartbeat", "flush", "timeout"};
+    unsigned long long expiries[] = {250, 100, 1000, 100};
+
+    for(int i = 0; i < 4; i++){
+        printf("Push timer '%s' expiring at '%llu' onto RadixHeap.\n", timers[i], expiries[i]);
+        result = RadixHeapPush(heap, expiries[i], (void *)timers[i]);
+        if(result != STD_DDS_SUCCESS){
+            PrintResultCode(result);
+            printf("Failed to push onto RadixHeap. Exiting.\n");
+            RadixHeapFree(heap);
+            return 1;
+        }
+    }
+
+    printf("\n-- RadixHeapPeek() --\n");
+
+    unsigned long long now;
+    const char *timer = (const char *)RadixHeapPeek(heap, &now);
+    printf("Timer '%s' expires first at '%llu'.\n", timer, now);
+
+    printf("\n-- RadixHeapPop() --\n");
+
+    timer = (const char *)RadixHeapPop(heap, &now);
+    printf("Timer '%s' fired at '%llu'.\n", timer, now);
+
+    printf("Rescheduling timer '%s' to '%llu'.\n", timer, now + 400);
+    RadixHeapPush(heap, now + 400, (void *)timer);
+
+    printf("Pushing a timer that expires in the past.\n");
+    result = RadixHeapPush(heap, now - 50, (void *)timer);
+    PrintResultCode(result);
+
+    while(RadixHeapGetLength(heap) > 0){
+        timer = (const char *)RadixHeapPop(heap, &now);
+        printf("Timer '%s' fired at '%llu'.\n", timer, now);
+    }
+
+    printf("\n-- RadixHeapFree() --\n");
+
+    printf("Freeing RadixHeap.\n");
+    result = RadixHeapFree(heap);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to free RadixHeap. Exiting.\n");
+        return 1;
+    }
+
+    return 0;
+}
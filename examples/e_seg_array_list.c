@@ -0,0 +1,141 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "std_dds_utils.h"
+#include "seg_array_list.h"
+
+#include <stdio.h>
+
+void PrintIntSegArrayList(SegArrayList *list) {
+    printf("Result: [");
+    for (size_t i = 0; i < SegArrayListGetLength(list); i++) {
+        int *value = (int *)SegArrayListGetAt(list, i);
+        if (value != NULL) {
+            printf("%d", *value);
+        } else {
+            printf("NULL");
+        }
+
+        if (i < SegArrayListGetLength(list) - 1) {
+            printf(", ");
+        }
+    }
+    printf("] (capacity: %zu)\n", SegArrayListGetCapacity(list));
+}
+
+int main(void){
+    STD_DDS_RESULT result;
+
+    printf("\n== std_dds SegArrayList Example ==\n");
+
+    printf("\n-- SegArrayListInit() --\n");
+
+    size_t blockCapacity = 4;
+    printf("Initialising a SegArrayList with blocks of '%zu' elements.\n", blockCapacity);
+    SegArrayList *list = SegArrayListInit(blockCapacity);
+    if(list == NULL){
+        printf("Failed to initialise SegArrayList. Exiting.\n");
+        return 1;
+    }
+    PrintIntSegArrayList(list);
+
+    printf("\n-- SegArrayListAppend() --\n");
+
+    int values[] = {10, 20, 30, 40, 50, 60};
+    for(size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++){
+        printf("Appending '%d' to SegArrayList.\n", values[i]);
+        result = SegArrayListAppend(list, &values[i]);
+        if(result != STD_DDS_SUCCESS){
+            PrintResultCode(result);
+            printf("Failed to append to SegArrayList. Exiting.\n");
+            SegArrayListFree(list);
+            return 1;
+        }
+    }
+    PrintIntSegArrayList(list);
+
+    printf("\n-- SegArrayListGetRefAt() --\n");
+
+    size_t refIndex = 1;
+    printf("Getting the slot address of index [%zu].\n", refIndex);
+    void **ref = SegArrayListGetRefAt(list, refIndex);
+    if(ref == NULL){
+        printf("Unable to get SegArrayList slot at index [%zu]. Exiting.\n", refIndex);
+        SegArrayListFree(list);
+        return 1;
+    }
+
+    printf("\n-- SegArrayListReserve() --\n");
+
+    size_t reserveCapacity = 32;
+    printf("Reserving room for '%zu' elements in SegArrayList.\n", reserveCapacity);
+    result = SegArrayListReserve(list, reserveCapacity);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to reserve SegArrayList capacity. Exiting.\n");
+        SegArrayListFree(list);
+        return 1;
+    }
+    PrintIntSegArrayList(list);
+
+    printf("Slot at index [%zu] still holds '%d' after growing.\n", refIndex, *(int *)*ref);
+
+    printf("\n-- SegArrayListSetAt() --\n");
+
+    int a = 25;
+    printf("Setting index [%zu] of SegArrayList to '%d'.\n", refIndex, a);
+    result = SegArrayListSetAt(list, refIndex, &a);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to set SegArrayList element. Exiting.\n");
+        SegArrayListFree(list);
+        return 1;
+    }
+    PrintIntSegArrayList(list);
+
+    printf("\n-- SegArrayListPop() --\n");
+
+    printf("Popping last element from SegArrayList.\n");
+    void *value = SegArrayListPop(list);
+    if(value == NULL){
+        printf("Popping last element from SegArrayList was unsuccessful. Exiting.\n");
+        SegArrayListFree(list);
+        return 1;
+    }
+
+    printf("'%d' popped from SegArrayList successfully.\n", *(int *)value);
+    PrintIntSegArrayList(list);
+
+    printf("\n-- SegArrayListShrinkToFit() --\n");
+
+    printf("Freeing unused SegArrayList blocks.\n");
+    result = SegArrayListShrinkToFit(list);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to shrink SegArrayList. Exiting.\n");
+        SegArrayListFree(list);
+        return 1;
+    }
+    PrintIntSegArrayList(list);
+
+    printf("\n-- SegArrayListFree() --\n");
+
+    printf("Freeing SegArrayList.\n");
+    SegArrayListFree(list);
+
+    return 0;
+}
@@ -0,0 +1,116 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "std_dds_core.h"
+#include "std_dds_utils.h"
+#include "skip_list.h"
+#include "epoch.h"
+
+#include <stdio.h>
+#include <string.h>
+
+int CompareStr(const void *a, const void *b){
+    return strcmp((const char *)a, (const char *)b);
+}
+
+int PrintEntry(void *key, void *value, void *ctx){
+    printf("  %s -> %d\n", (char *)key, *(int *)value);
+    return 0;
+}
+
+int main(void){
+    STD_DDS_RESULT result;
+
+    printf("\n== std_dds SkipList Example ==\n");
+
+    printf("\n-- SkipListInit() --\n");
+
+    printf("Initialising a SkipList of string keys.\n");
+    SkipList *list = SkipListInit(CompareStr);
+    if(list == NULL){
+        printf("Failed to initialise SkipList. Exiting.\n");
+        return 1;
+    }
+
+    printf("\n-- SkipListInsert() --\n");
+
+    char *keys[6] = {"pear", "apple", "fig", "kiwi", "banana", "cherry"};
+    int values[6] = {4, 1, 7, 2, 5, 3};
+    for(int i = 0; i < 6; i++){
+        printf("Inserting '%s' with value %d.\n", keys[i], values[i]);
+        result = SkipListInsert(list, keys[i], &values[i]);
+        if(result != STD_DDS_SUCCESS){
+            PrintResultCode(result);
+            printf("Failed to insert into SkipList. Exiting.\n");
+            SkipListFree(list);
+            return 1;
+        }
+    }
+
+    printf("Inserting '%s' again.\n", keys[0]);
+    result = SkipListInsert(list, keys[0], &values[0]);
+    PrintResultCode(result);
+
+    printf("\n-- SkipListRange() --\n");
+
+    printf("All keys in order:\n");
+    SkipListRange(list, NULL, NULL, PrintEntry, NULL);
+
+    printf("Keys from 'banana' to 'kiwi':\n");
+    SkipListRange(list, "banana", "kiwi", PrintEntry, NULL);
+
+    printf("\n-- SkipListGet() --\n");
+
+    int *value = (int *)SkipListGet(list, "fig");
+    if(value == NULL){
+        printf("Failed to get 'fig' from SkipList. Exiting.\n");
+        SkipListFree(list);
+        return 1;
+    }
+
+    printf("Value of 'fig': %d\n", *value);
+
+    printf("\n-- SkipListRemove() --\n");
+
+    value = (int *)SkipListRemove(list, "apple");
+    if(value == NULL){
+        printf("Failed to remove 'apple' from SkipList. Exiting.\n");
+        SkipListFree(list);
+        return 1;
+    }
+
+    printf("'apple' removed from the SkipList, its value was %d.\n", *value);
+    SkipListRange(list, NULL, NULL, PrintEntry, NULL);
+
+    printf("\n-- SkipListGetLength() --\n");
+
+    printf("SkipList length: %zu\n", SkipListGetLength(list));
+
+    printf("\n-- SkipListFree() --\n");
+
+    printf("Freeing SkipList and draining retired nodes.\n");
+    result = SkipListFree(list);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to free SkipList. Exiting.\n");
+        return 1;
+    }
+
+    EpochDrain();
+
+    return 0;
+}
@@ -0,0 +1,110 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "std_dds_core.h"
+#include "std_dds_utils.h"
+#include "spsc_queue.h"
+
+#include <stdio.h>
+
+int main(void){
+    STD_DDS_RESULT result;
+
+    printf("\n== std_dds SPSCQueue Example ==\n");
+
+    printf("\n-- SPSCQueueInit() --\n");
+
+    printf("Initialising an SPSCQueue with a capacity of 3 elements.\n");
+    SPSCQueue *queue = SPSCQueueInit(3);
+    if(queue == NULL){
+        printf("Failed to initialise SPSCQueue. Exiting.\n");
+        return 1;
+    }
+
+    printf("SPSCQueue capacity rounded up to %zu elements.\n", SPSCQueueGetCapacity(queue));
+
+    printf("\n-- SPSCQueueEnqueue() --\n");
+
+    int numbers[6] = {10, 20, 30, 40, 50, 60};
+
+    printf("Enqueue '%d' into SPSCQueue.\n", numbers[0]);
+    result = SPSCQueueEnqueue(queue, &numbers[0]);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to enqueue into SPSCQueue. Exiting.\n");
+        SPSCQueueFree(queue);
+        return 1;
+    }
+
+    printf("\n-- SPSCQueueEnqueueN() --\n");
+
+    void *values[5];
+    for(int i = 0; i < 5; i++){
+        values[i] = &numbers[i + 1];
+    }
+
+    size_t enqueued = SPSCQueueEnqueueN(queue, values, 5);
+    printf("%zu of 5 elements enqueued into the SPSCQueue before it filled up.\n", enqueued);
+
+    printf("Enqueue '%d' into the full SPSCQueue.\n", numbers[5]);
+    result = SPSCQueueEnqueue(queue, &numbers[5]);
+    PrintResultCode(result);
+
+    printf("\n-- SPSCQueuePeek() --\n");
+
+    void *value = SPSCQueuePeek(queue);
+    if(value == NULL){
+        printf("Failed to peek SPSCQueue. Exiting.\n");
+        SPSCQueueFree(queue);
+        return 1;
+    }
+
+    printf("'%d' is at the head of the SPSCQueue of length %zu.\n", *(int *)value, SPSCQueueGetLength(queue));
+
+    printf("\n-- SPSCQueueDequeue() --\n");
+
+    value = SPSCQueueDequeue(queue);
+    if(value == NULL){
+        printf("Failed to dequeue from SPSCQueue. Exiting.\n");
+        SPSCQueueFree(queue);
+        return 1;
+    }
+
+    printf("'%d' dequeued from SPSCQueue successfully.\n", *(int *)value);
+
+    printf("\n-- SPSCQueueDequeueN() --\n");
+
+    void *dequeued[4];
+    size_t dequeuedCount = SPSCQueueDequeueN(queue, dequeued, 4);
+    printf("%zu elements dequeued from the SPSCQueue: [", dequeuedCount);
+    for(size_t i = 0; i < dequeuedCount; i++){
+        printf("%d%s", *(int *)dequeued[i], i + 1 < dequeuedCount ? ", " : "");
+    }
+    printf("]\n");
+
+    printf("\n-- SPSCQueueFree() --\n");
+
+    printf("Freeing SPSCQueue.\n");
+    result = SPSCQueueFree(queue);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to free SPSCQueue. Exiting.\n");
+        return 1;
+    }
+
+    return 0;
+}
@@ -111,5 +111,99 @@ int main(void){
         return 1;
     }
 
+    printf("\n-- StackInitPooled() --\n");
+
+    printf("Initialising a pooled Stack with 16 nodes per slab.\n");
+    stack = StackInitPooled(16);
+    if(stack == NULL){
+        printf("Failed to initialise pooled Stack. Exiting.\n");
+        return 1;
+    }
+
+    int rounds[4] = {0, 1, 2, 3};
+    printf("Pushing and popping 4 rounds of 10 elements, reusing the same nodes.\n");
+    for(int round = 0; round < 4; round++){
+        for(int i = 0; i < 10; i++){
+            result = StackPush(stack, &rounds[round]);
+            if(result != STD_DDS_SUCCESS){
+                PrintResultCode(result);
+                printf("Failed to push onto pooled Stack. Exiting.\n");
+                StackFree(stack);
+                return 1;
+            }
+        }
+
+        while(StackGetLength(stack) > 0){
+            StackPop(stack);
+        }
+    }
+
+    printf("Pooled Stack length after all rounds: %zu\n", StackGetLength(stack));
+
+    printf("Freeing pooled Stack and its slabs.\n");
+    result = StackFree(stack);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to free pooled Stack. Exiting.\n");
+        return 1;
+    }
+
+    printf("\n-- StackInitArray() --\n");
+
+    printf("Initialising an array-backed Stack with a capacity of 2 elements.\n");
+    stack = StackInitArray(2);
+    if(stack == NULL){
+        printf("Failed to initialise array-backed Stack. Exiting.\n");
+        return 1;
+    }
+
+    printf("\n-- StackPushN() --\n");
+
+    char letters[] = "stack";
+    void *pushed[5];
+    for(int i = 0; i < 5; i++){
+        pushed[i] = &letters[i];
+    }
+
+    printf("Pushing the characters of \"%s\" onto the Stack at once.\n", letters);
+    result = StackPushN(stack, pushed, 5);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to push onto array-backed Stack. Exiting.\n");
+        StackFree(stack);
+        return 1;
+    }
+
+    printf("\n-- StackPeek() --\n");
+
+    void *value = StackPeek(stack);
+    if(value == NULL){
+        printf("Failed to peek array-backed Stack. Exiting.\n");
+        StackFree(stack);
+        return 1;
+    }
+
+    printf("'%c' is on top of the Stack of length %zu.\n", *(char *)value, StackGetLength(stack));
+
+    printf("\n-- StackPopN() --\n");
+
+    void *popped[3];
+    size_t poppedCount = StackPopN(stack, popped, 3);
+    printf("%zu elements popped from the Stack in push order: [", poppedCount);
+    for(size_t i = 0; i < poppedCount; i++){
+        printf("%c%s", *(char *)popped[i], i + 1 < poppedCount ? ", " : "");
+    }
+    printf("]\n");
+
+    printf("'%c' is now on top of the Stack of length %zu.\n", *(char *)StackPeek(stack), StackGetLength(stack));
+
+    printf("Freeing array-backed Stack.\n");
+    result = StackFree(stack);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to free array-backed Stack. Exiting.\n");
+        return 1;
+    }
+
     return 0;
 }
@@ -0,0 +1,106 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "std_dds_core.h"
+#include "std_dds_utils.h"
+#include "timing_wheel.h"
+
+#include <stdio.h>
+
+typedef struct connection {
+    int id;
+    WheelTimer timeout;
+} Connection;
+
+static TimingWheel *wheel;
+
+void ConnectionTimeout(WheelTimer *timer){
+    Connection *connection = STD_DDS_WHEEL_TIMER_ENTRY(timer, Connection, timeout);
+    printf("Connection '%d' timed out at tick '%llu'.\n", connection->id, TimingWheelGetNow(wheel));
+}
+
+int main(void){
+    STD_DDS_RESULT result;
+
+    printf("\n== std_dds TimingWheel Example ==\n");
+
+    printf("\n-- TimingWheelInit() --\n");
+
+    printf("Initialising a TimingWheel at tick 0.\n");
+    wheel = TimingWheelInit(0);
+    if(wheel == NULL){
+        printf("Failed to initialise TimingWheel. Exiting.\n");
+        return 1;
+    }
+
+    printf("\n-- TimingWheelSchedule() --\n");
+
+    Connection connections[4];
+    unsigned long long timeouts[4] = {30, 10, 5000, 10};
+
+    for(int i = 0; i < 4; i++){
+        connections[i].id = i;
+        WheelTimerInit(&connections[i].timeout, ConnectionTimeout);
+
+        printf("Scheduling connection '%d' to time out in '%llu' ticks.\n", i, timeouts[i]);
+        result = TimingWheelSchedule(wheel, &connections[i].timeout, timeouts[i]);
+        if(result != STD_DDS_SUCCESS){
+            PrintResultCode(result);
+            printf("Failed to schedule WheelTimer. Exiting.\n");
+            TimingWheelFree(wheel);
+            return 1;
+        }
+    }
+
+    printf("TimingWheel length: %zu\n", TimingWheelGetLength(wheel));
+
+    printf("\n-- TimingWheelCancel() --\n");
+
+    printf("Connection '3' closed, cancelling its timeout.\n");
+    result = TimingWheelCancel(wheel, &connections[3].timeout);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to cancel WheelTimer. Exiting.\n");
+        TimingWheelFree(wheel);
+        return 1;
+    }
+
+    printf("Connection '0' received data, rescheduling its timeout to '100' ticks.\n");
+    TimingWheelSchedule(wheel, &connections[0].timeout, 100);
+
+    printf("\n-- TimingWheelAdvance() --\n");
+
+    size_t fired = TimingWheelAdvance(wheel, 50);
+    printf("Advanced to tick '%llu', %zu timers fired.\n", TimingWheelGetNow(wheel), fired);
+
+    fired = TimingWheelAdvance(wheel, 10000);
+    printf("Advanced to tick '%llu', %zu timers fired.\n", TimingWheelGetNow(wheel), fired);
+
+    printf("TimingWheel length: %zu\n", TimingWheelGetLength(wheel));
+
+    printf("\n-- TimingWheelFree() --\n");
+
+    printf("Freeing TimingWheel.\n");
+    result = TimingWheelFree(wheel);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to free TimingWheel. Exiting.\n");
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,135 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "std_dds_core.h"
+#include "std_dds_utils.h"
+#include "unrolled_list.h"
+
+#include <stdio.h>
+
+void PrintIntUnrolledList(UnrolledList *list){
+    printf("Result: [");
+    for(UnrolledNode *node = UnrolledListGetHead(list); node != NULL; node = node->next){
+        printf("(");
+        for(size_t i = node->start; i < node->start + node->count; i++){
+            printf("%d%s", *(int *)node->values[i], i + 1 < node->start + node->count ? " " : "");
+        }
+        printf(")%s", node->next != NULL ? "->" : "");
+    }
+    printf("]\n");
+}
+
+int main(void){
+    STD_DDS_RESULT result;
+
+    printf("\n== std_dds UnrolledList Example ==\n");
+
+    printf("\n-- UnrolledListInit() --\n");
+
+    size_t nodeCapacity = 4;
+    printf("Initialising an UnrolledList with '%zu' values per node.\n", nodeCapacity);
+    UnrolledList *list = UnrolledListInit(nodeCapacity);
+    if(list == NULL){
+        printf("Failed to initialise UnrolledList. Exiting.\n");
+        return 1;
+    }
+
+    int values[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    printf("\n-- UnrolledListAppend() --\n");
+
+    printf("Appending values 3 to 9 onto the tail of the UnrolledList.\n");
+    for(int i = 3; i < 10; i++){
+        result = UnrolledListAppend(list, &values[i]);
+        if(result != STD_DDS_SUCCESS){
+            PrintResultCode(result);
+            printf("Failed to append UnrolledList. Exiting.\n");
+            UnrolledListFree(list);
+            return 1;
+        }
+    }
+
+    PrintIntUnrolledList(list);
+
+    printf("\n-- UnrolledListPush() --\n");
+
+    printf("Pushing values 2 to 0 onto the head of the UnrolledList.\n");
+    for(int i = 2; i >= 0; i--){
+        result = UnrolledListPush(list, &values[i]);
+        if(result != STD_DDS_SUCCESS){
+            PrintResultCode(result);
+            printf("Failed to push UnrolledList. Exiting.\n");
+            UnrolledListFree(list);
+            return 1;
+        }
+    }
+
+    PrintIntUnrolledList(list);
+
+    printf("\n-- UnrolledListGetAt() --\n");
+
+    size_t index = 6;
+    int *value = (int *)UnrolledListGetAt(list, index);
+    if(value == NULL){
+        printf("Failed to get element at index [%zu]. Exiting.\n", index);
+        UnrolledListFree(list);
+        return 1;
+    }
+
+    printf("Element at index [%zu]: %d\n", index, *value);
+
+    printf("\n-- UnrolledListPop() --\n");
+
+    value = (int *)UnrolledListPop(list);
+    if(value == NULL){
+        printf("Popping the head element from the UnrolledList was unsuccessful. Exiting.\n");
+        UnrolledListFree(list);
+        return 1;
+    }
+
+    printf("'%d' removed from the head of the UnrolledList successfully.\n", *value);
+
+    PrintIntUnrolledList(list);
+
+    printf("\n-- UnrolledListPopTail() --\n");
+
+    value = (int *)UnrolledListPopTail(list);
+    if(value == NULL){
+        printf("Popping the tail element from the UnrolledList was unsuccessful. Exiting.\n");
+        UnrolledListFree(list);
+        return 1;
+    }
+
+    printf("'%d' removed from the tail of the UnrolledList successfully.\n", *value);
+
+    PrintIntUnrolledList(list);
+
+    printf("\n-- UnrolledListGetLength() --\n");
+
+    printf("UnrolledList length: %zu\n", UnrolledListGetLength(list));
+
+    printf("\n-- UnrolledListFree() --\n");
+    printf("Freeing UnrolledList.\n");
+    result = UnrolledListFree(list);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to free UnrolledList. Exiting.\n");
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,82 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "std_dds_core.h"
+#include "std_dds_utils.h"
+#include "work_stealing_deque.h"
+#include "epoch.h"
+
+#include <stdio.h>
+
+int main(void){
+    STD_DDS_RESULT result;
+
+    printf("\n== std_dds WorkStealingDeque Example ==\n");
+
+    printf("\n-- WorkStealingDequeInit() --\n");
+
+    printf("Initialising a WorkStealingDeque with a capacity of 2 elements.\n");
+    WorkStealingDeque *deque = WorkStealingDequeInit(2);
+    if(deque == NULL){
+        printf("Failed to initialise WorkStealingDeque. Exiting.\n");
+        return 1;
+    }
+
+    printf("\n-- WorkStealingDequePush() --\n");
+
+    int tasks[6] = {1, 2, 3, 4, 5, 6};
+    for(int i = 0; i < 6; i++){
+        printf("Owner pushes task '%d' onto WorkStealingDeque.\n", tasks[i]);
+        result = WorkStealingDequePush(deque, &tasks[i]);
+        if(result != STD_DDS_SUCCESS){
+            PrintResultCode(result);
+            printf("Failed to push onto WorkStealingDeque. Exiting.\n");
+            WorkStealingDequeFree(deque);
+            return 1;
+        }
+    }
+
+    printf("WorkStealingDeque length: %zu\n", WorkStealingDequeGetLength(deque));
+
+    printf("\n-- WorkStealingDequePop() --\n");
+
+    for(int i = 0; i < 2; i++){
+        int *task = (int *)WorkStealingDequePop(deque);
+        printf("Owner pops its most recent task '%d'.\n", *task);
+    }
+
+    printf("\n-- WorkStealingDequeSteal() --\n");
+
+    int *task;
+    while((task = (int *)WorkStealingDequeSteal(deque)) != NULL){
+        printf("Thief steals the oldest task '%d'.\n", *task);
+    }
+
+    printf("\n-- WorkStealingDequeFree() --\n");
+
+    printf("Freeing WorkStealingDeque and draining outgrown arrays.\n");
+    result = WorkStealingDequeFree(deque);
+    if(result != STD_DDS_SUCCESS){
+        PrintResultCode(result);
+        printf("Failed to free WorkStealingDeque. Exiting.\n");
+        return 1;
+    }
+
+    EpochDrain();
+
+    return 0;
+}
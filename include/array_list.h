@@ -22,8 +22,32 @@
 
 #include <stddef.h>
 
+/**
+ * Define STD_DDS_ARRAY_LIST_MMAP_THRESHOLD (in bytes) to change the array size
+ * at which an ArrayList moves its array into its own memory mapping so that it
+ * can be grown with mremap instead of being copied. Only used on Linux.
+ * Define as 0 to always use malloc/realloc.
+**/
+#ifndef STD_DDS_ARRAY_LIST_MMAP_THRESHOLD
+    #define STD_DDS_ARRAY_LIST_MMAP_THRESHOLD (64 * 1024 * 1024)
+#endif
+
 typedef struct arrayList ArrayList;
 
+/**
+ * The growth policy used when an ArrayList runs out of capacity.
+ * The new capacity is (capacity * factor) + step, until the capacity
+ * reaches limit, after which the capacity grows linearly by limit elements.
+ * factor: Multiplicative growth factor, must be at least 1.0 (default 2.0).
+ * step: Elements added after applying factor (default 0).
+ * limit: Capacity at which growth becomes linear, 0 for no limit (default 0).
+**/
+typedef struct {
+    double factor;
+    size_t step;
+    size_t limit;
+} ArrayListGrowth;
+
 /**
  * Initialise and allocate memory for an ArrayList object with an initial array capacity.
  * @param capacity The initial capacity of the ArrayList array.
@@ -32,6 +56,46 @@ typedef struct arrayList ArrayList;
 **/
 ArrayList *ArrayListInit(const size_t capacity);
 
+/**
+ * Initialise and allocate memory for an ArrayList object holding a copy of an array of values.
+ * @param values The array of values to copy into the ArrayList.
+ * @param length The amount of values in the array.
+ * @return A pointer to the initialised ArrayList.
+ * Returns NULL if memory allocation failed.
+**/
+ArrayList *ArrayListInitFromArray(void *const *values, const size_t length);
+
+/**
+ * Initialise and allocate memory for an ArrayList object that stores its first
+ * elements inline, in the same allocation as the ArrayList itself.
+ * The array only moves to a separate allocation once it grows past inlineCapacity,
+ * and moves back inline if it is later shrunk to fit within it.
+ * @param inlineCapacity The amount of elements stored inline.
+ * @return A pointer to the initialised ArrayList.
+ * Returns NULL if memory allocation failed.
+**/
+ArrayList *ArrayListInitInline(const size_t inlineCapacity);
+
+/**
+ * Open or create an ArrayList whose array is stored in a memory-mapped file.
+ * The ArrayList grows by extending and remapping the file, and reopening the
+ * file restores its elements without reading them in. Each element is stored as
+ * a pointer-sized word, so only store values that stay meaningful across runs
+ * (e.g. indices cast with (void *)(uintptr_t)). Only supported on Linux.
+ * The length is written to the file by ArrayListSync() and ArrayListFree().
+ * @param path The path of the file to open or create.
+ * @return A pointer to the opened ArrayList.
+ * Returns NULL if the file could not be opened or mapped, or is not an ArrayList file.
+**/
+ArrayList *ArrayListOpenMapped(const char *path);
+
+/**
+ * Write the elements and length of a file-backed ArrayList to its file.
+ * @param list The ArrayList opened with ArrayListOpenMapped() to sync.
+ * @return STD_DDS_RESULT
+**/
+STD_DDS_RESULT ArrayListSync(ArrayList *list);
+
 /**
  * Resize an ArrayList's array to a specified capacity.
  * @param list The ArrayList to resize.
@@ -40,6 +104,30 @@ ArrayList *ArrayListInit(const size_t capacity);
 */
 STD_DDS_RESULT ArrayListResize(ArrayList *list, const size_t capacity);
 
+/**
+ * Set the growth policy of an ArrayList.
+ * @param list The ArrayList to modify.
+ * @param growth The growth policy to use when the ArrayList is full.
+ * @return STD_DDS_RESULT
+**/
+STD_DDS_RESULT ArrayListSetGrowth(ArrayList *list, const ArrayListGrowth growth);
+
+/**
+ * Ensure an ArrayList's array has room for at least a specified amount of elements.
+ * Never reduces the capacity of the ArrayList.
+ * @param list The ArrayList to modify.
+ * @param capacity The minimum capacity of the array.
+ * @return STD_DDS_RESULT
+**/
+STD_DDS_RESULT ArrayListReserve(ArrayList *list, const size_t capacity);
+
+/**
+ * Reduce the capacity of an ArrayList's array to its current length.
+ * @param list The ArrayList to modify.
+ * @return STD_DDS_RESULT
+**/
+STD_DDS_RESULT ArrayListShrinkToFit(ArrayList *list);
+
 /**
  * Get the value of an element in an ArrayList based on its index in the array.
  * @param list The ArrayList to get the element from.
@@ -66,6 +154,15 @@ STD_DDS_RESULT ArrayListSetAt(ArrayList *list, const int index, void *value);
 **/
 STD_DDS_RESULT ArrayListFill(ArrayList *list, void *value);
 
+/**
+ * Set each element, up to its capacity, to a repeating pattern of values.
+ * @param list The ArrayList to modify.
+ * @param pattern The array of values to repeat.
+ * @param patternLength The amount of values in the pattern.
+ * @return STD_DDS_RESULT
+**/
+STD_DDS_RESULT ArrayListFillPattern(ArrayList *list, void *const *pattern, const size_t patternLength);
+
 /**
  * Push a new element to the head (index [0]) of an ArrayList
  * @param list The ArrayList to push the element into.
@@ -82,6 +179,15 @@ STD_DDS_RESULT ArrayListPush(ArrayList *list, void *value);
 **/
 STD_DDS_RESULT ArrayListAppend(ArrayList *list, void *value); 
 
+/**
+ * Append a copy of an array of values to the tail of an ArrayList.
+ * @param list The ArrayList to append the values to.
+ * @param values The array of values to append.
+ * @param length The amount of values in the array.
+ * @return STD_DDS_RESULT
+**/
+STD_DDS_RESULT ArrayListAppendArray(ArrayList *list, void *const *values, const size_t length);
+
 /**
  * Insert a new element into a specified index of an ArrayList. 
  * Shifts all elements above the index.
@@ -110,6 +216,35 @@ void *ArrayListPop(ArrayList *list);
 **/
 void *ArrayListRemoveAt(ArrayList *list, const int index);
 
+/**
+ * Find the first element of an ArrayList that is the specified pointer.
+ * @param list The ArrayList to search.
+ * @param value The pointer to find.
+ * @return The index of the first matching element.
+ * Returns -1 if the list is NULL or does not contain the value.
+**/
+size_t ArrayListIndexOf(const ArrayList *list, const void *value);
+
+/**
+ * Count the elements of an ArrayList that are the specified pointer.
+ * @param list The ArrayList to search.
+ * @param value The pointer to count.
+ * @return The amount of matching elements.
+ * Returns -1 if the list is NULL.
+**/
+size_t ArrayListCount(const ArrayList *list, const void *value);
+
+/**
+ * Remove every element of an ArrayList that matches a predicate, keeping the
+ * order of the remaining elements.
+ * @param list The ArrayList to remove elements from.
+ * @param predicate Returns non-zero for each element value to remove.
+ * @param ctx A pointer passed to each call of predicate.
+ * @return The amount of elements removed.
+ * Returns -1 if the list or predicate is NULL.
+**/
+size_t ArrayListRemoveIf(ArrayList *list, int (*predicate)(void *value, void *ctx), void *ctx);
+
 /**
  * Get the current length of an ArrayList.
  * @param list The ArrayList to query.
@@ -128,6 +263,7 @@ size_t ArrayListGetCapacity(const ArrayList *list);
 
 /**
  * Free the memory allocated for an ArrayList object and its array.
+ * File-backed ArrayLists write their length, unmap and close their file instead.
  * DOES NOT free the memory of each element's value in its array.
  * @param list The ArrayList to free.
  * @return STD_DDS_RESULT
@@ -0,0 +1,97 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef STD_DDS_CONCURRENT_STACK_H
+#define STD_DDS_CONCURRENT_STACK_H
+
+#include "std_dds_core.h"
+
+#include <stddef.h>
+
+/**
+ * A ConcurrentStack is a lock-free (Treiber) stack that may be pushed to and
+ * popped from by several threads at once. Popped nodes are reclaimed through
+ * epochs, see epoch.h. A node can therefore not be freed and reallocated at
+ * the same address while another thread is still comparing against it,
+ * which rules out ABA without a tagged or double-width head.
+**/
+typedef struct concurrentStack ConcurrentStack;
+
+/**
+ * Initialise and allocate memory for a ConcurrentStack object.
+ * @return A pointer to the initialised ConcurrentStack.
+ * Returns NULL if memory allocation failed.
+**/
+ConcurrentStack *ConcurrentStackInit(void);
+
+/**
+ * Push a new element to the top of a ConcurrentStack.
+ * Safe to call concurrently with any ConcurrentStack function other than ConcurrentStackFree().
+ * @param stack The ConcurrentStack to push the element onto.
+ * @param value A pointer to the element to push.
+ * @return STD_DDS_RESULT.
+**/
+STD_DDS_RESULT ConcurrentStackPush(ConcurrentStack *stack, void *value);
+
+/**
+ * Push several elements onto a ConcurrentStack with a single atomic update,
+ * values[n - 1] ends up on top. Other threads never see part of the batch.
+ * Safe to call concurrently with any ConcurrentStack function other than ConcurrentStackFree().
+ * @param stack The ConcurrentStack to push the elements onto.
+ * @param values An array of at least n element values.
+ * @param n The amount of elements to push.
+ * @return STD_DDS_RESULT.
+**/
+STD_DDS_RESULT ConcurrentStackPushN(ConcurrentStack *stack, void *const *values, const size_t n);
+
+/**
+ * Remove an element from the top of a ConcurrentStack.
+ * Safe to call concurrently with any ConcurrentStack function other than ConcurrentStackFree().
+ * @param stack The ConcurrentStack to pop an element from.
+ * @return A pointer to the value of the element removed.
+ * Returns NULL if the ConcurrentStack is empty.
+**/
+void *ConcurrentStackPop(ConcurrentStack *stack);
+
+/**
+ * Get the element on top of a ConcurrentStack without removing it.
+ * The element may be popped by another thread as soon as this returns.
+ * @param stack The ConcurrentStack to query.
+ * @return A pointer to the value of the top element.
+ * Returns NULL if the ConcurrentStack is empty.
+**/
+void *ConcurrentStackPeek(ConcurrentStack *stack);
+
+/**
+ * Get the current length of a ConcurrentStack.
+ * Only exact while no other thread is pushing or popping.
+ * @param stack The ConcurrentStack to query.
+ * @return The ConcurrentStack's length.
+ * Returns -1 if the ConcurrentStack is NULL.
+**/
+size_t ConcurrentStackGetLength(const ConcurrentStack *stack);
+
+/**
+ * Free the memory allocated for a ConcurrentStack and its elements.
+ * DOES NOT free the memory of each element's value.
+ * No other thread may be using the stack. Nodes already popped are freed through EpochCollect().
+ * @param stack The ConcurrentStack to free.
+ * @return STD_DDS_RESULT.
+**/
+STD_DDS_RESULT ConcurrentStackFree(ConcurrentStack *stack);
+
+#endif // STD_DDS_CONCURRENT_STACK_H
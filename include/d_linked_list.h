@@ -46,6 +46,17 @@ DLinkedNode *DLinkedNodeInit(void *value);
 **/
 DLinkedList *DLinkedListInit();
 
+/** 
+ * Initialise and allocate memory for a DLinkedList object whose nodes are
+ * taken from its own NodePool, so pushing and popping reuse nodes instead of calling
+ * malloc and free, and DLinkedListFree() releases every slab at once.
+ * @param slabLength The amount of nodes allocated per slab.
+ * A value of 0 uses STD_DDS_NODE_POOL_SLAB_LENGTH.
+ * @return A pointer to the initialised DLinkedList.
+ * Returns NULL if memory allocation failed.
+**/
+DLinkedList *DLinkedListInitPooled(const size_t slabLength);
+
 /** 
  * Push a new node onto the head of a DLinkedList.
  * @param list The DLinkedList to push a node onto.
@@ -79,6 +90,71 @@ void *DLinkedListPop(DLinkedList *list);
 void *DLinkedListPopTail(DLinkedList *list);
 
 
+/**
+ * Insert a new node directly after a node of a DLinkedList in O(1).
+ * @param list The DLinkedList to insert a node into.
+ * @param node A node currently in the list.
+ * @param value A pointer to the value of the new node.
+ * @return A pointer to the new node.
+ * Returns NULL if a parameter is NULL or memory allocation failed.
+**/
+DLinkedNode *DLinkedListInsertAfter(DLinkedList *list, DLinkedNode *node, void *value);
+
+/**
+ * Insert a new node directly before a node of a DLinkedList in O(1).
+ * @param list The DLinkedList to insert a node into.
+ * @param node A node currently in the list.
+ * @param value A pointer to the value of the new node.
+ * @return A pointer to the new node.
+ * Returns NULL if a parameter is NULL or memory allocation failed.
+**/
+DLinkedNode *DLinkedListInsertBefore(DLinkedList *list, DLinkedNode *node, void *value);
+
+/**
+ * Remove a node from anywhere in a DLinkedList in O(1).
+ * @param list The DLinkedList to remove the node from.
+ * @param node A node currently in the list, freed by this function.
+ * @return A pointer to the value of the node removed.
+ * Returns NULL if a parameter is NULL.
+**/
+void *DLinkedListUnlink(DLinkedList *list, DLinkedNode *node);
+
+/**
+ * Move every node of one DLinkedList onto the tail of another in O(1).
+ * Pooled lists must either share a pool or src's pool must not be shared,
+ * in which case it is merged into dst's pool and both lists then share it.
+ * @param dst The DLinkedList to append the nodes onto.
+ * @param src The DLinkedList to take the nodes from, left empty but still valid.
+ * @return STD_DDS_RESULT.
+ * Returns STD_DDS_INVALID_PARAM if the lists are the same or their nodes are
+ * allocated incompatibly.
+**/
+STD_DDS_RESULT DLinkedListSplice(DLinkedList *dst, DLinkedList *src);
+
+/**
+ * Cut a DLinkedList before a node, moving that node and every node after it
+ * into a new DLinkedList. The length of the new list is counted from
+ * whichever end of the cut is closer. A pooled list shares its pool with
+ * the new list.
+ * @param list The DLinkedList to split.
+ * @param node A node currently in the list, becomes the head of the new list.
+ * @return A pointer to the new DLinkedList.
+ * Returns NULL if a parameter is NULL or memory allocation failed.
+**/
+DLinkedList *DLinkedListSplitAt(DLinkedList *list, DLinkedNode *node);
+
+/**
+ * Sort the nodes of a DLinkedList in place with a stable, bottom-up merge sort.
+ * Nodes are relinked rather than reallocated and only O(log n) auxiliary
+ * space is used. Ascending and strictly descending runs already in the list
+ * are taken whole, so a sorted or reversed list is sorted in O(n).
+ * @param list The DLinkedList to sort.
+ * @param compare Compares two node values, returning a negative value, 0 or a
+ * positive value if the first is less than, equal to or greater than the second.
+ * @return STD_DDS_RESULT.
+**/
+STD_DDS_RESULT DLinkedListSort(DLinkedList *list, int (*compare)(const void *a, const void *b));
+
 /**
  * Get the current length of a DLinkedList.
  * @param list The DLinkedList to query.
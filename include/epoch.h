@@ -0,0 +1,88 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef STD_DDS_EPOCH_H
+#define STD_DDS_EPOCH_H
+
+#include "std_dds_core.h"
+
+#include <stddef.h>
+
+/*
+Epoch-based reclamation for the concurrent std_dds structures.
+
+A thread inside EpochEnter()/EpochExit() may keep reading nodes it found in a
+concurrent structure. A node unlinked by any thread is passed to EpochRetire()
+and only freed once every thread that could still hold it has left the epoch
+it was retired in. Each thread registers itself on its first EpochEnter().
+
+Define STD_DDS_EPOCH_COLLECT_THRESHOLD to set how many pointers a thread
+retires between attempts to advance the epoch and free its retired pointers
+(default 64).
+*/
+
+#ifndef STD_DDS_EPOCH_COLLECT_THRESHOLD
+    #define STD_DDS_EPOCH_COLLECT_THRESHOLD 64
+#endif
+
+/**
+ * Enter an epoch-protected section on the calling thread.
+ * Sections may be nested, only the outermost EpochEnter()/EpochExit() pair pins the thread.
+ * @return STD_DDS_RESULT.
+ * Returns STD_DDS_MALLOC_FAILED if the thread could not be registered.
+**/
+STD_DDS_RESULT EpochEnter(void);
+
+/**
+ * Leave an epoch-protected section on the calling thread.
+ * @return STD_DDS_RESULT.
+**/
+STD_DDS_RESULT EpochExit(void);
+
+/**
+ * Retire a pointer that has been unlinked from every shared structure,
+ * freeing it with freeFunc once no thread can still be reading it.
+ * @param ptr The pointer to retire.
+ * @param freeFunc The function used to free ptr.
+ * @return STD_DDS_RESULT.
+**/
+STD_DDS_RESULT EpochRetire(void *ptr, void (*freeFunc)(void *));
+
+/**
+ * Try to advance the global epoch and free the calling thread's retired
+ * pointers that are no longer reachable by any thread.
+ * @return The amount of retired pointers the calling thread still holds.
+**/
+size_t EpochCollect(void);
+
+/**
+ * Unregister the calling thread, called before a thread exits.
+ * Its retired pointers are kept and freed by the next thread registered in its place.
+ * The thread must not be inside an epoch-protected section.
+ * @return STD_DDS_RESULT.
+**/
+STD_DDS_RESULT EpochThreadRelease(void);
+
+/**
+ * Free every retired pointer of every thread immediately.
+ * ONLY call when no thread is inside an epoch-protected section,
+ * e.g. after joining all worker threads.
+ * @return STD_DDS_RESULT.
+**/
+STD_DDS_RESULT EpochDrain(void);
+
+#endif // STD_DDS_EPOCH_H
@@ -0,0 +1,135 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef STD_DDS_GAP_BUFFER_H
+#define STD_DDS_GAP_BUFFER_H
+
+#include "std_dds_core.h"
+
+#include <stddef.h>
+
+/**
+ * A GapBuffer is an array of elements with a movable gap of unused slots at
+ * its cursor. Inserting or removing at the cursor is O(1) amortised, the
+ * elements between the old and new cursor are only moved when the cursor jumps.
+**/
+typedef struct gapBuffer GapBuffer;
+
+/**
+ * Initialise and allocate memory for a GapBuffer object with an initial capacity.
+ * The cursor starts at index [0].
+ * @param capacity The initial capacity of the GapBuffer array.
+ * @return A pointer to the initialised GapBuffer.
+ * Returns NULL if memory allocation failed.
+**/
+GapBuffer *GapBufferInit(const size_t capacity);
+
+/**
+ * Move the cursor of a GapBuffer to a specified index.
+ * @param buffer The GapBuffer to modify.
+ * @param index The index to move the cursor to, from 0 up to the buffer's length.
+ * @return STD_DDS_RESULT
+**/
+STD_DDS_RESULT GapBufferMoveCursor(GapBuffer *buffer, const size_t index);
+
+/**
+ * Get the current cursor index of a GapBuffer.
+ * @param buffer The GapBuffer to query.
+ * @return The GapBuffer's cursor index.
+ * Returns -1 if buffer is NULL.
+**/
+size_t GapBufferGetCursor(const GapBuffer *buffer);
+
+/**
+ * Insert a new element at the cursor of a GapBuffer and move the cursor past it.
+ * @param buffer The GapBuffer to insert the element into.
+ * @param value A pointer to the value of the element to insert.
+ * @return STD_DDS_RESULT
+**/
+STD_DDS_RESULT GapBufferInsert(GapBuffer *buffer, void *value);
+
+/**
+ * Insert a new element at a specified index of a GapBuffer, moving the cursor past it.
+ * @param buffer The GapBuffer to insert the element into.
+ * @param index The index to insert the element at.
+ * @param value A pointer to the value of the element to insert.
+ * @return STD_DDS_RESULT
+**/
+STD_DDS_RESULT GapBufferInsertAt(GapBuffer *buffer, const size_t index, void *value);
+
+/**
+ * Remove the element after the cursor of a GapBuffer.
+ * @param buffer The GapBuffer to remove an element from.
+ * @return A pointer to the value of the element removed.
+ * Returns NULL if the cursor is at the end of the buffer.
+**/
+void *GapBufferRemove(GapBuffer *buffer);
+
+/**
+ * Remove the element before the cursor of a GapBuffer, moving the cursor back by one.
+ * @param buffer The GapBuffer to remove an element from.
+ * @return A pointer to the value of the element removed.
+ * Returns NULL if the cursor is at the start of the buffer.
+**/
+void *GapBufferRemoveBefore(GapBuffer *buffer);
+
+/**
+ * Remove an element at a specified index of a GapBuffer, moving the cursor to the index.
+ * @param buffer The GapBuffer to remove an element from.
+ * @param index The index of the element to remove.
+ * @return A pointer to the value of the element removed.
+ * Returns NULL if the index is out-of-bounds.
+**/
+void *GapBufferRemoveAt(GapBuffer *buffer, const size_t index);
+
+/**
+ * Get the value of an element in a GapBuffer based on its index.
+ * Does not move the cursor.
+ * @param buffer The GapBuffer to get the element from.
+ * @param index The index of the element to get.
+ * @return A pointer to the value of an element at the specified index.
+ * Returns NULL if out-of-bounds.
+**/
+void *GapBufferGetAt(const GapBuffer *buffer, const size_t index);
+
+/**
+ * Set an element at an index to a specified value.
+ * Does not move the cursor.
+ * @param buffer The GapBuffer to modify.
+ * @param index The index of the element to modify.
+ * @param value The value to set the element to.
+ * @return STD_DDS_RESULT
+**/
+STD_DDS_RESULT GapBufferSetAt(GapBuffer *buffer, const size_t index, void *value);
+
+/**
+ * Get the current length of a GapBuffer.
+ * @param buffer The GapBuffer to query.
+ * @return The GapBuffer's length.
+ * Returns -1 if buffer is NULL.
+**/
+size_t GapBufferGetLength(const GapBuffer *buffer);
+
+/**
+ * Free the memory allocated for a GapBuffer object and its array.
+ * DOES NOT free the memory of each element's value.
+ * @param buffer The GapBuffer to free.
+ * @return STD_DDS_RESULT
+**/
+STD_DDS_RESULT GapBufferFree(GapBuffer *buffer);
+
+#endif // STD_DDS_GAP_BUFFER_H
@@ -0,0 +1,154 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef STD_DDS_INTRUSIVE_LIST_H
+#define STD_DDS_INTRUSIVE_LIST_H
+
+#include "std_dds_core.h"
+
+#include <stddef.h>
+
+/**
+ * A DLinkedHook is embedded in a user's struct to link it into an IntrusiveList.
+ * A struct can be linked into several lists at once with one hook per list.
+**/
+typedef struct dLinkedHook {
+    struct dLinkedHook *prev;
+    struct dLinkedHook *next;
+} DLinkedHook;
+
+/**
+ * An IntrusiveList is a doubly linked list of DLinkedHooks owned by the caller,
+ * no list operation allocates or frees memory.
+ * A zero-initialised IntrusiveList is a valid empty list.
+**/
+typedef struct intrusiveList {
+    DLinkedHook *head;
+    DLinkedHook *tail;
+    size_t length;
+} IntrusiveList;
+
+/**
+ * Get a pointer to the struct of a given type that embeds hook as member.
+**/
+#define STD_DDS_INTRUSIVE_LIST_ENTRY(hook, type, member) STD_DDS_CONTAINER_OF(hook, type, member)
+
+/**
+ * Iterate over each hook of an IntrusiveList from head to tail.
+ * hook is declared by the macro as a DLinkedHook *.
+**/
+#define STD_DDS_INTRUSIVE_LIST_FOR_EACH(list, hook) \
+    for (DLinkedHook *hook = (list)->head; hook != NULL; hook = hook->next)
+
+/**
+ * Iterate over each hook of an IntrusiveList from head to tail, allowing the
+ * current hook to be removed. hook and next are declared by the macro as DLinkedHook *.
+**/
+#define STD_DDS_INTRUSIVE_LIST_FOR_EACH_SAFE(list, hook, next) \
+    for (DLinkedHook *hook = (list)->head, *next = hook != NULL ? hook->next : NULL; \
+        hook != NULL; hook = next, next = hook != NULL ? hook->next : NULL)
+
+/**
+ * Initialise an IntrusiveList as empty.
+ * @param list The IntrusiveList to initialise.
+ * @return STD_DDS_RESULT.
+**/
+STD_DDS_RESULT IntrusiveListInit(IntrusiveList *list);
+
+/**
+ * Link a hook onto the head of an IntrusiveList.
+ * @param list The IntrusiveList to push the hook onto.
+ * @param hook The hook to link, must not currently be linked into this list.
+ * @return STD_DDS_RESULT.
+**/
+STD_DDS_RESULT IntrusiveListPush(IntrusiveList *list, DLinkedHook *hook);
+
+/**
+ * Link a hook onto the tail of an IntrusiveList.
+ * @param list The IntrusiveList to append the hook onto.
+ * @param hook The hook to link, must not currently be linked into this list.
+ * @return STD_DDS_RESULT.
+**/
+STD_DDS_RESULT IntrusiveListAppend(IntrusiveList *list, DLinkedHook *hook);
+
+/**
+ * Link a hook into an IntrusiveList directly after another hook.
+ * @param list The IntrusiveList to insert the hook into.
+ * @param position A hook currently linked into the list.
+ * @param hook The hook to link, must not currently be linked into this list.
+ * @return STD_DDS_RESULT.
+**/
+STD_DDS_RESULT IntrusiveListInsertAfter(IntrusiveList *list, DLinkedHook *position, DLinkedHook *hook);
+
+/**
+ * Link a hook into an IntrusiveList directly before another hook.
+ * @param list The IntrusiveList to insert the hook into.
+ * @param position A hook currently linked into the list.
+ * @param hook The hook to link, must not currently be linked into this list.
+ * @return STD_DDS_RESULT.
+**/
+STD_DDS_RESULT IntrusiveListInsertBefore(IntrusiveList *list, DLinkedHook *position, DLinkedHook *hook);
+
+/**
+ * Unlink the head hook of an IntrusiveList.
+ * @param list The IntrusiveList to pop the head hook from.
+ * @return The hook removed.
+ * Returns NULL if the list is empty.
+**/
+DLinkedHook *IntrusiveListPop(IntrusiveList *list);
+
+/**
+ * Unlink the tail hook of an IntrusiveList.
+ * @param list The IntrusiveList to pop the tail hook from.
+ * @return The hook removed.
+ * Returns NULL if the list is empty.
+**/
+DLinkedHook *IntrusiveListPopTail(IntrusiveList *list);
+
+/**
+ * Unlink a hook from anywhere in an IntrusiveList in O(1).
+ * @param list The IntrusiveList the hook is linked into.
+ * @param hook The hook to unlink.
+ * @return STD_DDS_RESULT.
+**/
+STD_DDS_RESULT IntrusiveListRemove(IntrusiveList *list, DLinkedHook *hook);
+
+/**
+ * Get the current length of an IntrusiveList.
+ * @param list The IntrusiveList to query.
+ * @return The IntrusiveList's length.
+ * Returns -1 if the list is NULL.
+**/
+size_t IntrusiveListGetLength(const IntrusiveList *list);
+
+/**
+ * Get the current head hook of an IntrusiveList.
+ * @param list The IntrusiveList to query.
+ * @return The IntrusiveList's head hook.
+ * Returns NULL if the list is empty.
+**/
+DLinkedHook *IntrusiveListGetHead(const IntrusiveList *list);
+
+/**
+ * Get the current tail hook of an IntrusiveList.
+ * @param list The IntrusiveList to query.
+ * @return The IntrusiveList's tail hook.
+ * Returns NULL if the list is empty.
+**/
+DLinkedHook *IntrusiveListGetTail(const IntrusiveList *list);
+
+#endif // STD_DDS_INTRUSIVE_LIST_H
@@ -46,6 +46,37 @@ LinkedNode *LinkedNodeInit(void *value);
 **/
 LinkedList *LinkedListInit();
 
+/** 
+ * Initialise and allocate memory for a LinkedList object whose nodes also
+ * link back to their previous node, making LinkedListPopTail() O(1).
+ * Its nodes are still LinkedNodes and can be traversed through next as usual.
+ * @return A pointer to the initialised LinkedList.
+ * Returns NULL if memory allocation failed.
+**/
+LinkedList *LinkedListInitBackLinked();
+
+/** 
+ * Initialise and allocate memory for a LinkedList object whose nodes are
+ * taken from its own NodePool, so pushing and popping reuse nodes instead of
+ * calling malloc and free, and LinkedListFree() releases every slab at once.
+ * @param slabLength The amount of nodes allocated per slab.
+ * A value of 0 uses STD_DDS_NODE_POOL_SLAB_LENGTH.
+ * @return A pointer to the initialised LinkedList.
+ * Returns NULL if memory allocation failed.
+**/
+LinkedList *LinkedListInitPooled(const size_t slabLength);
+
+/** 
+ * Initialise and allocate memory for a back-linked LinkedList object whose
+ * nodes are taken from its own NodePool.
+ * See LinkedListInitBackLinked() and LinkedListInitPooled().
+ * @param slabLength The amount of nodes allocated per slab.
+ * A value of 0 uses STD_DDS_NODE_POOL_SLAB_LENGTH.
+ * @return A pointer to the initialised LinkedList.
+ * Returns NULL if memory allocation failed.
+**/
+LinkedList *LinkedListInitBackLinkedPooled(const size_t slabLength);
+
 /** 
  * Push a new node onto the head of a LinkedList.
  * @param list The LinkedList to push a node onto.
@@ -78,6 +109,30 @@ void *LinkedListPop(LinkedList *list);
 **/
 void *LinkedListPopTail(LinkedList *list);
 
+/**
+ * Remove up to n nodes from the tail of a LinkedList in a single traversal.
+ * @param list The LinkedList to pop the tail nodes from.
+ * @param values An array of at least n elements to store the removed values in,
+ * in the order they would be popped by LinkedListPopTail() (values[0] is the old tail).
+ * May be NULL to discard the values.
+ * @param n The maximum amount of nodes to remove.
+ * @return The amount of nodes removed.
+ * Returns -1 if the list is NULL.
+**/
+size_t LinkedListPopTailN(LinkedList *list, void **values, const size_t n);
+
+/**
+ * Sort the nodes of a LinkedList in place with a stable, bottom-up merge sort.
+ * Nodes are relinked rather than reallocated and only O(log n) auxiliary
+ * space is used. Ascending and strictly descending runs already in the list
+ * are taken whole, so a sorted or reversed list is sorted in O(n).
+ * @param list The LinkedList to sort.
+ * @param compare Compares two node values, returning a negative value, 0 or a
+ * positive value if the first is less than, equal to or greater than the second.
+ * @return STD_DDS_RESULT.
+**/
+STD_DDS_RESULT LinkedListSort(LinkedList *list, int (*compare)(const void *a, const void *b));
+
 /**
  * Get the current length of a LinkedList.
  * @param list The LinkedList to query.
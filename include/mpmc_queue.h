@@ -0,0 +1,104 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef STD_DDS_MPMC_QUEUE_H
+#define STD_DDS_MPMC_QUEUE_H
+
+#include "std_dds_core.h"
+
+#include <stddef.h>
+
+/**
+ * An MPMCQueue is a bounded, lock-free queue that any amount of threads may
+ * enqueue into and dequeue from at once. Every cell of its ring carries a
+ * sequence number telling producers and consumers whose turn it is, so a
+ * single CAS on the enqueue or dequeue position claims a cell.
+ * The Try functions never block. MPMCQueueEnqueue() and MPMCQueueDequeue()
+ * sleep on a condition variable while the queue is full or empty.
+**/
+typedef struct mpmcQueue MPMCQueue;
+
+/**
+ * Initialise and allocate memory for an MPMCQueue object.
+ * @param capacity The maximum amount of elements the MPMCQueue can hold,
+ * rounded up to a power of two of at least 2.
+ * @return A pointer to the initialised MPMCQueue.
+ * Returns NULL if capacity is 0 or memory allocation failed.
+**/
+MPMCQueue *MPMCQueueInit(const size_t capacity);
+
+/**
+ * Add a new element to the tail of an MPMCQueue without blocking.
+ * @param queue The MPMCQueue to enqueue an element into.
+ * @param value A pointer to the value of the new element.
+ * @return STD_DDS_RESULT.
+ * Returns STD_DDS_FULL if the MPMCQueue is at capacity.
+**/
+STD_DDS_RESULT MPMCQueueTryEnqueue(MPMCQueue *queue, void *value);
+
+/**
+ * Remove the head element of an MPMCQueue without blocking.
+ * @param queue The MPMCQueue to dequeue an element from.
+ * @return A pointer to the value of the element removed.
+ * Returns NULL if the MPMCQueue is empty.
+**/
+void *MPMCQueueTryDequeue(MPMCQueue *queue);
+
+/**
+ * Add a new element to the tail of an MPMCQueue, waiting for space while it is full.
+ * @param queue The MPMCQueue to enqueue an element into.
+ * @param value A pointer to the value of the new element.
+ * @return STD_DDS_RESULT.
+**/
+STD_DDS_RESULT MPMCQueueEnqueue(MPMCQueue *queue, void *value);
+
+/**
+ * Remove the head element of an MPMCQueue, waiting for an element while it is empty.
+ * NULL values should not be enqueued when using this function.
+ * @param queue The MPMCQueue to dequeue an element from.
+ * @return A pointer to the value of the element removed.
+ * Returns NULL if the MPMCQueue is NULL.
+**/
+void *MPMCQueueDequeue(MPMCQueue *queue);
+
+/**
+ * Get the current length of an MPMCQueue.
+ * Only exact while no other thread is enqueuing or dequeuing.
+ * @param queue The MPMCQueue to query.
+ * @return The MPMCQueue's length.
+ * Returns -1 if the MPMCQueue is NULL.
+**/
+size_t MPMCQueueGetLength(const MPMCQueue *queue);
+
+/**
+ * Get the capacity of an MPMCQueue.
+ * @param queue The MPMCQueue to query.
+ * @return The maximum amount of elements the MPMCQueue can hold.
+ * Returns -1 if the MPMCQueue is NULL.
+**/
+size_t MPMCQueueGetCapacity(const MPMCQueue *queue);
+
+/**
+ * Free the memory allocated for an MPMCQueue.
+ * DOES NOT free the memory of each element's value.
+ * No other thread may be using or waiting on the MPMCQueue.
+ * @param queue The MPMCQueue to free.
+ * @return STD_DDS_RESULT.
+**/
+STD_DDS_RESULT MPMCQueueFree(MPMCQueue *queue);
+
+#endif // STD_DDS_MPMC_QUEUE_H
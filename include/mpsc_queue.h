@@ -0,0 +1,91 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef STD_DDS_MPSC_QUEUE_H
+#define STD_DDS_MPSC_QUEUE_H
+
+#include "std_dds_core.h"
+
+#include <stddef.h>
+#include <stdatomic.h>
+
+/**
+ * An MPSCHook is embedded in a user's struct to link it into an MPSCQueue.
+ * A hook may only be in one MPSCQueue at a time.
+**/
+typedef struct mpscHook {
+    _Atomic(struct mpscHook *) next;
+} MPSCHook;
+
+/**
+ * An MPSCQueue is an unbounded, intrusive queue of MPSCHooks owned by the caller
+ * that any amount of producer threads may enqueue into while a single consumer
+ * thread dequeues. Enqueueing is a single atomic exchange and never blocks or
+ * allocates, dequeueing needs no read-modify-write atomics except when the
+ * queue runs down to its last element.
+**/
+typedef struct mpscQueue MPSCQueue;
+
+/**
+ * Get a pointer to the struct of a given type that embeds hook as member.
+**/
+#define STD_DDS_MPSC_QUEUE_ENTRY(hook, type, member) STD_DDS_CONTAINER_OF(hook, type, member)
+
+/**
+ * Initialise and allocate memory for an MPSCQueue object.
+ * @return A pointer to the initialised MPSCQueue.
+ * Returns NULL if memory allocation failed.
+**/
+MPSCQueue *MPSCQueueInit(void);
+
+/**
+ * Link a hook onto the tail of an MPSCQueue.
+ * Safe to call from any amount of threads at once.
+ * @param queue The MPSCQueue to enqueue the hook into.
+ * @param hook The hook to link, must not currently be linked into any MPSCQueue.
+ * @return STD_DDS_RESULT.
+**/
+STD_DDS_RESULT MPSCQueueEnqueue(MPSCQueue *queue, MPSCHook *hook);
+
+/**
+ * Unlink the head hook of an MPSCQueue. Consumer only.
+ * May return NULL while a producer is half way through enqueueing onto an
+ * otherwise empty MPSCQueue, the hook becomes visible once that producer finishes.
+ * @param queue The MPSCQueue to dequeue a hook from.
+ * @return The hook removed from the MPSCQueue.
+ * Returns NULL if the MPSCQueue is empty.
+**/
+MPSCHook *MPSCQueueDequeue(MPSCQueue *queue);
+
+/**
+ * Check whether an MPSCQueue has no hooks left to dequeue. Consumer only.
+ * @param queue The MPSCQueue to query.
+ * @return 1 if the MPSCQueue is empty, 0 if it is not.
+ * Returns -1 if the MPSCQueue is NULL.
+**/
+int MPSCQueueIsEmpty(const MPSCQueue *queue);
+
+/**
+ * Free the memory allocated for an MPSCQueue.
+ * DOES NOT free or unlink the hooks still in the queue.
+ * No other thread may be using the MPSCQueue.
+ * @param queue The MPSCQueue to free.
+ * @return STD_DDS_RESULT.
+**/
+STD_DDS_RESULT MPSCQueueFree(MPSCQueue *queue);
+
+#endif // STD_DDS_MPSC_QUEUE_H
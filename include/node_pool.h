@@ -0,0 +1,117 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef STD_DDS_NODE_POOL_H
+#define STD_DDS_NODE_POOL_H
+
+#include "std_dds_core.h"
+
+#include <stddef.h>
+
+/* 
+Define STD_DDS_NODE_POOL_SLAB_LENGTH to set the default amount of nodes
+allocated per slab when a slab length of 0 is requested (default 64).
+*/
+
+#ifndef STD_DDS_NODE_POOL_SLAB_LENGTH
+    #define STD_DDS_NODE_POOL_SLAB_LENGTH 64
+#endif
+
+typedef struct nodePool NodePool;
+
+/**
+ * Initialise and allocate memory for a NodePool object that hands out
+ * fixed size nodes from slabs, recycling released nodes through a freelist.
+ * No slab is allocated until the first node is requested.
+ * @param nodeSize The size in bytes of each node. Nodes are pointer aligned.
+ * @param slabLength The amount of nodes allocated per slab.
+ * A value of 0 uses STD_DDS_NODE_POOL_SLAB_LENGTH.
+ * @return A pointer to the initialised NodePool.
+ * Returns NULL if nodeSize is 0 or memory allocation failed.
+**/
+NodePool *NodePoolInit(const size_t nodeSize, const size_t slabLength);
+
+/**
+ * Take a node from a NodePool, allocating a new slab only when both the
+ * freelist and the current slab are exhausted.
+ * The node's memory is uninitialised.
+ * @param pool The NodePool to allocate from.
+ * @return A pointer to the node.
+ * Returns NULL if the pool is NULL or memory allocation failed.
+**/
+void *NodePoolAlloc(NodePool *pool);
+
+/**
+ * Return a node to the freelist of the NodePool it was allocated from.
+ * @param pool The NodePool the node was allocated from.
+ * @param node The node to release.
+ * @return STD_DDS_RESULT.
+**/
+STD_DDS_RESULT NodePoolRelease(NodePool *pool, void *node);
+
+/**
+ * Add a reference to a NodePool so it can be shared between containers.
+ * Each reference is dropped by one call to NodePoolFree().
+ * @param pool The NodePool to retain.
+ * @return STD_DDS_RESULT.
+**/
+STD_DDS_RESULT NodePoolRetain(NodePool *pool);
+
+/**
+ * Move every slab and free node of one NodePool into another, so nodes
+ * allocated from src can be released to and freed with dst.
+ * src is left empty but remains valid.
+ * @param dst The NodePool to merge into.
+ * @param src The NodePool to merge from, must have the same node size and not be shared.
+ * @return STD_DDS_RESULT.
+**/
+STD_DDS_RESULT NodePoolMerge(NodePool *dst, NodePool *src);
+
+/**
+ * Get the size in bytes of each node of a NodePool.
+ * @param pool The NodePool to query.
+ * @return The NodePool's node size.
+ * Returns -1 if the pool is NULL.
+**/
+size_t NodePoolGetNodeSize(const NodePool *pool);
+
+/**
+ * Get the amount of nodes currently allocated from a NodePool and not yet released.
+ * @param pool The NodePool to query.
+ * @return The NodePool's amount of live nodes.
+ * Returns -1 if the pool is NULL.
+**/
+size_t NodePoolGetLength(const NodePool *pool);
+
+/**
+ * Get the amount of references currently held on a NodePool.
+ * @param pool The NodePool to query.
+ * @return The NodePool's reference count.
+ * Returns -1 if the pool is NULL.
+**/
+size_t NodePoolGetRefCount(const NodePool *pool);
+
+/**
+ * Drop a reference to a NodePool, freeing the memory allocated for it and
+ * all of its slabs at once when the last reference is dropped.
+ * Every node allocated from the pool then becomes invalid.
+ * @param pool The NodePool to free.
+ * @return STD_DDS_RESULT.
+**/
+STD_DDS_RESULT NodePoolFree(NodePool *pool);
+
+#endif // STD_DDS_NODE_POOL_H
@@ -0,0 +1,125 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef STD_DDS_PAIRING_HEAP_H
+#define STD_DDS_PAIRING_HEAP_H
+
+#include "std_dds_core.h"
+
+#include <stddef.h>
+
+/**
+ * A PairingHeapNode is the handle returned when inserting into a PairingHeap.
+ * It stays valid until its element is popped or removed, key and value may be
+ * read directly but key must only be changed through PairingHeapDecreaseKey().
+ * prev is the parent of a leftmost child and the left sibling otherwise.
+**/
+typedef struct pairingHeapNode {
+    long long key;
+    void *value;
+    struct pairingHeapNode *child;
+    struct pairingHeapNode *sibling;
+    struct pairingHeapNode *prev;
+} PairingHeapNode;
+
+/**
+ * A PairingHeap is an addressable min-heap ordered by long long keys.
+ * Insert, meld and decrease-key take O(1) time, pop and remove take amortised
+ * O(log n). Nodes are taken from the heap's own NodePool.
+**/
+typedef struct pairingHeap PairingHeap;
+
+/**
+ * Initialise and allocate memory for a PairingHeap object.
+ * @return A pointer to the initialised PairingHeap.
+ * Returns NULL if memory allocation failed.
+**/
+PairingHeap *PairingHeapInit(void);
+
+/**
+ * Add a new element to a PairingHeap.
+ * @param heap The PairingHeap to insert the element into.
+ * @param key The priority of the element, lower keys are popped first.
+ * @param value A pointer to the value of the element.
+ * @return The handle of the new element.
+ * Returns NULL if the PairingHeap is NULL or memory allocation failed.
+**/
+PairingHeapNode *PairingHeapInsert(PairingHeap *heap, const long long key, void *value);
+
+/**
+ * Get the element with the lowest key of a PairingHeap without removing it.
+ * @param heap The PairingHeap to query.
+ * @return The handle of the first element.
+ * Returns NULL if the PairingHeap is empty.
+**/
+PairingHeapNode *PairingHeapPeek(const PairingHeap *heap);
+
+/**
+ * Remove the element with the lowest key of a PairingHeap.
+ * @param heap The PairingHeap to pop an element from.
+ * @param key Set to the key of the element removed. May be NULL.
+ * @return A pointer to the value of the element removed.
+ * Returns NULL if the PairingHeap is empty.
+**/
+void *PairingHeapPop(PairingHeap *heap, long long *key);
+
+/**
+ * Lower the key of an element of a PairingHeap.
+ * @param heap The PairingHeap containing the element.
+ * @param node The handle of the element.
+ * @param key The new key, no greater than the element's current key.
+ * @return STD_DDS_RESULT.
+ * Returns STD_DDS_INVALID_PARAM if key is greater than the current key.
+**/
+STD_DDS_RESULT PairingHeapDecreaseKey(PairingHeap *heap, PairingHeapNode *node, const long long key);
+
+/**
+ * Remove an element from anywhere in a PairingHeap.
+ * @param heap The PairingHeap containing the element.
+ * @param node The handle of the element, invalid once this returns.
+ * @return A pointer to the value of the element removed.
+ * Returns NULL if the PairingHeap or node is NULL.
+**/
+void *PairingHeapRemove(PairingHeap *heap, PairingHeapNode *node);
+
+/**
+ * Move every element of one PairingHeap into another in O(1).
+ * The handles of src's elements remain valid and now belong to dst.
+ * src is left empty but remains valid.
+ * @param dst The PairingHeap to meld the elements into.
+ * @param src The PairingHeap to take the elements from.
+ * @return STD_DDS_RESULT.
+**/
+STD_DDS_RESULT PairingHeapMeld(PairingHeap *dst, PairingHeap *src);
+
+/**
+ * Get the current length of a PairingHeap.
+ * @param heap The PairingHeap to query.
+ * @return The PairingHeap's length.
+ * Returns -1 if the PairingHeap is NULL.
+**/
+size_t PairingHeapGetLength(const PairingHeap *heap);
+
+/**
+ * Free the memory allocated for a PairingHeap and its nodes.
+ * DOES NOT free the memory of each element's value.
+ * @param heap The PairingHeap to free.
+ * @return STD_DDS_RESULT.
+**/
+STD_DDS_RESULT PairingHeapFree(PairingHeap *heap);
+
+#endif // STD_DDS_PAIRING_HEAP_H
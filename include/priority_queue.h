@@ -0,0 +1,152 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef STD_DDS_PRIORITY_QUEUE_H
+#define STD_DDS_PRIORITY_QUEUE_H
+
+#include "std_dds_core.h"
+#include "array_list.h"
+
+#include <stddef.h>
+
+/* 
+Define STD_DDS_PRIORITY_QUEUE_ARITY to set the amount of children of each
+PriorityQueue heap node when initialised with an arity of 0 (default 4).
+*/
+
+#ifndef STD_DDS_PRIORITY_QUEUE_ARITY
+    #define STD_DDS_PRIORITY_QUEUE_ARITY 4
+#endif
+
+/**
+ * A PriorityQueueEntry is a single element of a PriorityQueue's heap.
+ * key is only used by a PriorityQueue initialised without a comparator.
+**/
+typedef struct priorityQueueEntry {
+    long long key;
+    void *value;
+} PriorityQueueEntry;
+
+/**
+ * A PriorityQueue is an implicit d-ary min-heap stored in one contiguous array.
+ * Elements are ordered either by a comparator on their values or, when
+ * initialised without one, by a long long key given with each value.
+**/
+typedef struct priorityQueue PriorityQueue;
+
+/**
+ * Initialise and allocate memory for a PriorityQueue object.
+ * @param arity The amount of children of each heap node, at least 2.
+ * A value of 0 uses STD_DDS_PRIORITY_QUEUE_ARITY.
+ * @param compare Compares two values, returning a negative value if a should be
+ * popped before b, 0 if they are equal or a positive value otherwise.
+ * If NULL the PriorityQueue is keyed, use PriorityQueuePushKeyed().
+ * @return A pointer to the initialised PriorityQueue.
+ * Returns NULL if arity is 1 or memory allocation failed.
+**/
+PriorityQueue *PriorityQueueInit(const size_t arity, int (*compare)(const void *a, const void *b));
+
+/**
+ * Initialise and allocate memory for a PriorityQueue object holding the values
+ * of an ArrayList, heapified in O(n). The ArrayList is not modified.
+ * @param list The ArrayList to copy the values from.
+ * @param arity The amount of children of each heap node, at least 2.
+ * A value of 0 uses STD_DDS_PRIORITY_QUEUE_ARITY.
+ * @param compare Compares two values, as for PriorityQueueInit(). Must not be NULL.
+ * @return A pointer to the initialised PriorityQueue.
+ * Returns NULL if list or compare is NULL, arity is 1 or memory allocation failed.
+**/
+PriorityQueue *PriorityQueueInitFromArrayList(const ArrayList *list, const size_t arity, int (*compare)(const void *a, const void *b));
+
+/**
+ * Add a new value to a PriorityQueue ordered by a comparator.
+ * @param queue The PriorityQueue to push the value onto.
+ * @param value A pointer to the value to add.
+ * @return STD_DDS_RESULT.
+ * Returns STD_DDS_INVALID_PARAM if the PriorityQueue is keyed.
+**/
+STD_DDS_RESULT PriorityQueuePush(PriorityQueue *queue, void *value);
+
+/**
+ * Add a new value to a keyed PriorityQueue, lower keys are popped first.
+ * @param queue The PriorityQueue to push the value onto.
+ * @param key The priority of the value.
+ * @param value A pointer to the value to add.
+ * @return STD_DDS_RESULT.
+ * Returns STD_DDS_INVALID_PARAM if the PriorityQueue is ordered by a comparator.
+**/
+STD_DDS_RESULT PriorityQueuePushKeyed(PriorityQueue *queue, const long long key, void *value);
+
+/**
+ * Remove the first element of a PriorityQueue.
+ * @param queue The PriorityQueue to pop an element from.
+ * @return A pointer to the value of the element removed.
+ * Returns NULL if the PriorityQueue is empty.
+**/
+void *PriorityQueuePop(PriorityQueue *queue);
+
+/**
+ * Remove the first element of a PriorityQueue along with its key.
+ * @param queue The PriorityQueue to pop an element from.
+ * @param key Set to the key of the element removed. May be NULL.
+ * @return A pointer to the value of the element removed.
+ * Returns NULL if the PriorityQueue is empty.
+**/
+void *PriorityQueuePopKeyed(PriorityQueue *queue, long long *key);
+
+/**
+ * Get the first element of a PriorityQueue without removing it.
+ * @param queue The PriorityQueue to query.
+ * @return A pointer to the value of the first element.
+ * Returns NULL if the PriorityQueue is empty.
+**/
+void *PriorityQueuePeek(const PriorityQueue *queue);
+
+/**
+ * Get the first element of a PriorityQueue and its key without removing it.
+ * @param queue The PriorityQueue to query.
+ * @param key Set to the key of the first element. May be NULL.
+ * @return A pointer to the value of the first element.
+ * Returns NULL if the PriorityQueue is empty.
+**/
+void *PriorityQueuePeekKeyed(const PriorityQueue *queue, long long *key);
+
+/**
+ * Get the current length of a PriorityQueue.
+ * @param queue The PriorityQueue to query.
+ * @return The PriorityQueue's length.
+ * Returns -1 if the PriorityQueue is NULL.
+**/
+size_t PriorityQueueGetLength(const PriorityQueue *queue);
+
+/**
+ * Get the arity of a PriorityQueue's heap.
+ * @param queue The PriorityQueue to query.
+ * @return The amount of children of each heap node.
+ * Returns -1 if the PriorityQueue is NULL.
+**/
+size_t PriorityQueueGetArity(const PriorityQueue *queue);
+
+/**
+ * Free the memory allocated for a PriorityQueue.
+ * DOES NOT free the memory of each element's value.
+ * @param queue The PriorityQueue to free.
+ * @return STD_DDS_RESULT.
+**/
+STD_DDS_RESULT PriorityQueueFree(PriorityQueue *queue);
+
+#endif // STD_DDS_PRIORITY_QUEUE_H
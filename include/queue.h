@@ -32,6 +32,30 @@ typedef struct queue Queue;
 **/
 Queue *QueueInit();
 
+/** 
+ * Initialise and allocate memory for a Queue object whose nodes are
+ * taken from its own NodePool, so enqueueing and dequeueing reuse nodes instead of calling
+ * malloc and free, and QueueFree() releases every slab at once.
+ * @param slabLength The amount of nodes allocated per slab.
+ * A value of 0 uses STD_DDS_NODE_POOL_SLAB_LENGTH.
+ * @return A pointer to the initialised Queue.
+ * Returns NULL if memory allocation failed.
+**/
+Queue *QueueInitPooled(const size_t slabLength);
+
+/**
+ * Initialise and allocate memory for a Queue object that stores its elements
+ * in a circular array, so enqueueing and dequeueing never call malloc or free.
+ * The capacity is always a power of two and doubles when the Queue is full.
+ * QueueGetHead() and QueueGetTail() always return NULL for a ring-backed Queue,
+ * use QueuePeek().
+ * @param capacity The initial capacity of the Queue's array, rounded up to a
+ * power of two.
+ * @return A pointer to the initialised Queue.
+ * Returns NULL if memory allocation failed.
+**/
+Queue *QueueInitRing(const size_t capacity);
+
 /**
  * Add a new element to the tail of a Queue.
  * @param queue The Queue to enqueue an element into.
@@ -49,6 +73,38 @@ STD_DDS_RESULT QueueEnqueue(Queue *queue, void *value);
 **/
 void *QueueDequeue(Queue *queue);
 
+/**
+ * Add several elements to the tail of a Queue in order, values[0] is dequeued first.
+ * A ring-backed Queue grows at most once and copies the values with at most
+ * two memcpy calls.
+ * @param queue The Queue to enqueue the elements into.
+ * @param values An array of at least n element values.
+ * @param n The amount of elements to enqueue.
+ * @return STD_DDS_RESULT.
+**/
+STD_DDS_RESULT QueueEnqueueN(Queue *queue, void *const *values, const size_t n);
+
+/**
+ * Remove up to n elements from the head of a Queue.
+ * The values are written in dequeue order, values[0] is the former head.
+ * A ring-backed Queue copies the values with at most two memcpy calls.
+ * @param queue The Queue to dequeue the elements from.
+ * @param values An array of at least n elements to store the removed values in.
+ * May be NULL to discard the values.
+ * @param n The maximum amount of elements to remove.
+ * @return The amount of elements removed.
+ * Returns -1 if the Queue is NULL.
+**/
+size_t QueueDequeueN(Queue *queue, void **values, const size_t n);
+
+/**
+ * Get the head element of a Queue without removing it.
+ * @param queue The Queue to query.
+ * @return A pointer to the value of the head element.
+ * Returns NULL if the Queue is empty.
+**/
+void *QueuePeek(const Queue *queue);
+
 /**
  * Get the current length of a Queue.
  * @param queue The Queue to query.
@@ -61,7 +117,7 @@ size_t QueueGetLength(const Queue *queue);
  * Get the current head element of the Queue.
  * @param queue The Queue to query.
  * @return The Queue's head element.
- * Returns NULL if the Queue is empty.
+ * Returns NULL if the Queue is empty or ring-backed.
 **/
 DLinkedNode *QueueGetHead(const Queue *queue);
 
@@ -69,7 +125,7 @@ DLinkedNode *QueueGetHead(const Queue *queue);
  * Get the current tail element of the Queue.
  * @param queue The Queue to query.
  * @return The Queue's tail element.
- * Returns NULL if the Queue is empty.
+ * Returns NULL if the Queue is empty or ring-backed.
 **/
 DLinkedNode *QueueGetTail(const Queue *queue);
 
@@ -0,0 +1,88 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef STD_DDS_RADIX_HEAP_H
+#define STD_DDS_RADIX_HEAP_H
+
+#include "std_dds_core.h"
+
+#include <stddef.h>
+
+/**
+ * A RadixHeap is a min-heap for monotone unsigned integer keys, a key pushed
+ * must never be lower than the last key popped, as with the distances of
+ * Dijkstra's algorithm or the expiry times of timers.
+ * Elements are kept in 65 buckets by the highest bit in which their key
+ * differs from the last key popped, so push takes O(1) time and each element
+ * moves between buckets at most 64 times over its life.
+ * Nodes are taken from the heap's own NodePool.
+**/
+typedef struct radixHeap RadixHeap;
+
+/**
+ * Initialise and allocate memory for a RadixHeap object.
+ * @return A pointer to the initialised RadixHeap.
+ * Returns NULL if memory allocation failed.
+**/
+RadixHeap *RadixHeapInit(void);
+
+/**
+ * Add a new element to a RadixHeap.
+ * @param heap The RadixHeap to push the element onto.
+ * @param key The priority of the element, no lower than the last key popped.
+ * @param value A pointer to the value of the element.
+ * @return STD_DDS_RESULT.
+ * Returns STD_DDS_INVALID_PARAM if key is lower than the last key popped.
+**/
+STD_DDS_RESULT RadixHeapPush(RadixHeap *heap, const unsigned long long key, void *value);
+
+/**
+ * Remove an element with the lowest key of a RadixHeap.
+ * @param heap The RadixHeap to pop an element from.
+ * @param key Set to the key of the element removed. May be NULL.
+ * @return A pointer to the value of the element removed.
+ * Returns NULL if the RadixHeap is empty.
+**/
+void *RadixHeapPop(RadixHeap *heap, unsigned long long *key);
+
+/**
+ * Get an element with the lowest key of a RadixHeap without removing it.
+ * May move elements between the RadixHeap's buckets.
+ * @param heap The RadixHeap to query.
+ * @param key Set to the key of the first element. May be NULL.
+ * @return A pointer to the value of the first element.
+ * Returns NULL if the RadixHeap is empty.
+**/
+void *RadixHeapPeek(RadixHeap *heap, unsigned long long *key);
+
+/**
+ * Get the current length of a RadixHeap.
+ * @param heap The RadixHeap to query.
+ * @return The RadixHeap's length.
+ * Returns -1 if the RadixHeap is NULL.
+**/
+size_t RadixHeapGetLength(const RadixHeap *heap);
+
+/**
+ * Free the memory allocated for a RadixHeap and its nodes.
+ * DOES NOT free the memory of each element's value.
+ * @param heap The RadixHeap to free.
+ * @return STD_DDS_RESULT.
+**/
+STD_DDS_RESULT RadixHeapFree(RadixHeap *heap);
+
+#endif // STD_DDS_RADIX_HEAP_H
@@ -0,0 +1,125 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef STD_DDS_SEG_ARRAY_LIST_H
+#define STD_DDS_SEG_ARRAY_LIST_H
+
+#include "std_dds_core.h"
+
+#include <stddef.h>
+
+/**
+ * A SegArrayList stores its elements in a directory of fixed-size blocks.
+ * Growing the list only allocates new blocks, existing elements are never
+ * moved, so pointers returned by SegArrayListGetRefAt() stay valid until the
+ * list is shrunk or freed.
+**/
+typedef struct segArrayList SegArrayList;
+
+/**
+ * Initialise and allocate memory for a SegArrayList object.
+ * @param blockCapacity The amount of elements in each block, must be a power of two.
+ * @return A pointer to the initialised SegArrayList.
+ * Returns NULL if memory allocation failed or blockCapacity is not a power of two.
+**/
+SegArrayList *SegArrayListInit(const size_t blockCapacity);
+
+/**
+ * Allocate enough blocks for a SegArrayList to hold at least a specified amount of elements.
+ * @param list The SegArrayList to modify.
+ * @param capacity The minimum capacity of the list.
+ * @return STD_DDS_RESULT
+**/
+STD_DDS_RESULT SegArrayListReserve(SegArrayList *list, const size_t capacity);
+
+/**
+ * Get the value of an element in a SegArrayList based on its index.
+ * @param list The SegArrayList to get the element from.
+ * @param index The index of the element to get.
+ * @return A pointer to the value of an element at the specified index.
+ * Returns NULL if out-of-bounds.
+**/
+void *SegArrayListGetAt(const SegArrayList *list, const size_t index);
+
+/**
+ * Get the address of the slot holding an element in a SegArrayList.
+ * The address stays valid while the list grows.
+ * @param list The SegArrayList to get the slot from.
+ * @param index The index of the element's slot.
+ * @return A pointer to the slot at the specified index.
+ * Returns NULL if out-of-bounds.
+**/
+void **SegArrayListGetRefAt(SegArrayList *list, const size_t index);
+
+/**
+ * Set an element at an index to a specified value.
+ * @param list The SegArrayList to modify.
+ * @param index The index of the element to modify.
+ * @param value The value to set the element to.
+ * @return STD_DDS_RESULT
+**/
+STD_DDS_RESULT SegArrayListSetAt(SegArrayList *list, const size_t index, void *value);
+
+/**
+ * Append a new element to the tail of a SegArrayList.
+ * @param list The SegArrayList to append the element to.
+ * @param value A pointer to the value of an element to append to the list.
+ * @return STD_DDS_RESULT
+**/
+STD_DDS_RESULT SegArrayListAppend(SegArrayList *list, void *value);
+
+/**
+ * Remove the last element from a SegArrayList.
+ * @param list The SegArrayList to pop an element from.
+ * @return A pointer to the value of the element that was removed from the list.
+ * Returns NULL if the list is empty.
+**/
+void *SegArrayListPop(SegArrayList *list);
+
+/**
+ * Free the blocks of a SegArrayList that are not needed to hold its current length.
+ * Invalidates slot addresses past the current length.
+ * @param list The SegArrayList to modify.
+ * @return STD_DDS_RESULT
+**/
+STD_DDS_RESULT SegArrayListShrinkToFit(SegArrayList *list);
+
+/**
+ * Get the current length of a SegArrayList.
+ * @param list The SegArrayList to query.
+ * @return The SegArrayList's length.
+ * Returns -1 if list is NULL.
+**/
+size_t SegArrayListGetLength(const SegArrayList *list);
+
+/**
+ * Get the current capacity of a SegArrayList.
+ * @param list The SegArrayList to query.
+ * @return The SegArrayList's capacity.
+ * Returns -1 if list is NULL.
+**/
+size_t SegArrayListGetCapacity(const SegArrayList *list);
+
+/**
+ * Free the memory allocated for a SegArrayList object and its blocks.
+ * DOES NOT free the memory of each element's value.
+ * @param list The SegArrayList to free.
+ * @return STD_DDS_RESULT
+**/
+STD_DDS_RESULT SegArrayListFree(SegArrayList *list);
+
+#endif // STD_DDS_SEG_ARRAY_LIST_H
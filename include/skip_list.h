@@ -0,0 +1,113 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef STD_DDS_SKIP_LIST_H
+#define STD_DDS_SKIP_LIST_H
+
+#include "std_dds_core.h"
+
+#include <stddef.h>
+
+/* 
+Define STD_DDS_SKIP_LIST_MAX_LEVEL to set the maximum amount of levels of a
+SkipList node (default 32). Suited to lists of up to 2^STD_DDS_SKIP_LIST_MAX_LEVEL keys.
+*/
+
+#ifndef STD_DDS_SKIP_LIST_MAX_LEVEL
+    #define STD_DDS_SKIP_LIST_MAX_LEVEL 32
+#endif
+
+/**
+ * A SkipList is a sorted map of unique keys that may be used by several
+ * threads at once. Insert, Get and Remove are lock-free (Fraser, Herlihy
+ * and Shavit) and removed nodes are reclaimed through epochs, see epoch.h.
+**/
+typedef struct skipList SkipList;
+
+/**
+ * Initialise and allocate memory for a SkipList object.
+ * @param compare Compares two keys, returning a negative value, 0 or a
+ * positive value if the first is less than, equal to or greater than the second.
+ * @return A pointer to the initialised SkipList.
+ * Returns NULL if compare is NULL or memory allocation failed.
+**/
+SkipList *SkipListInit(int (*compare)(const void *a, const void *b));
+
+/**
+ * Insert a key and its value into a SkipList.
+ * Safe to call concurrently with any SkipList function other than SkipListFree().
+ * @param list The SkipList to insert into.
+ * @param key A pointer to the key to insert.
+ * @param value A pointer to the value of the key.
+ * @return STD_DDS_RESULT.
+ * Returns STD_DDS_DUPLICATE_VALUE if the key is already in the list.
+**/
+STD_DDS_RESULT SkipListInsert(SkipList *list, void *key, void *value);
+
+/**
+ * Get the value of a key in a SkipList.
+ * Safe to call concurrently with any SkipList function other than SkipListFree().
+ * @param list The SkipList to query.
+ * @param key A pointer to the key to find.
+ * @return A pointer to the value of the key.
+ * Returns NULL if the key was not found.
+**/
+void *SkipListGet(const SkipList *list, const void *key);
+
+/**
+ * Remove a key from a SkipList.
+ * Safe to call concurrently with any SkipList function other than SkipListFree().
+ * @param list The SkipList to remove the key from.
+ * @param key A pointer to the key to remove.
+ * Other threads may still be comparing against the removed key until they
+ * leave their epoch, so free removed keys through EpochRetire().
+ * @return A pointer to the value of the key removed.
+ * Returns NULL if the key was not found.
+**/
+void *SkipListRemove(SkipList *list, const void *key);
+
+/**
+ * Call a function on each key of a SkipList from min to max, in ascending order.
+ * Keys inserted or removed concurrently may or may not be visited.
+ * @param list The SkipList to iterate over.
+ * @param min A pointer to the lowest key to visit, NULL to start from the first key.
+ * @param max A pointer to the highest key to visit, NULL to continue to the last key.
+ * @param callback Called with each key, its value and ctx. Returning non-zero stops the iteration.
+ * @param ctx A pointer passed to each call of callback.
+ * @return The amount of keys visited.
+ * Returns -1 if list or callback is NULL.
+**/
+size_t SkipListRange(const SkipList *list, const void *min, const void *max, int (*callback)(void *key, void *value, void *ctx), void *ctx);
+
+/**
+ * Get the current length of a SkipList.
+ * @param list The SkipList to query.
+ * @return The SkipList's length.
+ * Returns -1 if the list is NULL.
+**/
+size_t SkipListGetLength(const SkipList *list);
+
+/**
+ * Free the memory allocated for a SkipList and its nodes.
+ * DOES NOT free the keys or values.
+ * No other thread may be using the list. Nodes already removed are freed through EpochCollect().
+ * @param list The SkipList to free.
+ * @return STD_DDS_RESULT.
+**/
+STD_DDS_RESULT SkipListFree(SkipList *list);
+
+#endif // STD_DDS_SKIP_LIST_H
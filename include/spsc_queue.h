@@ -0,0 +1,119 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef STD_DDS_SPSC_QUEUE_H
+#define STD_DDS_SPSC_QUEUE_H
+
+#include "std_dds_core.h"
+
+#include <stddef.h>
+
+/**
+ * An SPSCQueue is a bounded, wait-free ring buffer queue shared by exactly
+ * one producer thread and one consumer thread. Only the producer may call
+ * SPSCQueueEnqueue() and SPSCQueueEnqueueN(), only the consumer may call
+ * SPSCQueueDequeue(), SPSCQueueDequeueN() and SPSCQueuePeek().
+ * The producer and consumer indices sit on separate cache lines and each side
+ * keeps a cached copy of the other's index, only re-reading it when the queue
+ * looks full or empty.
+**/
+typedef struct spscQueue SPSCQueue;
+
+/**
+ * Initialise and allocate memory for an SPSCQueue object.
+ * @param capacity The maximum amount of elements the SPSCQueue can hold,
+ * rounded up to a power of two.
+ * @return A pointer to the initialised SPSCQueue.
+ * Returns NULL if capacity is 0 or memory allocation failed.
+**/
+SPSCQueue *SPSCQueueInit(const size_t capacity);
+
+/**
+ * Add a new element to the tail of an SPSCQueue. Producer only.
+ * @param queue The SPSCQueue to enqueue an element into.
+ * @param value A pointer to the value of the new element.
+ * @return STD_DDS_RESULT.
+ * Returns STD_DDS_FULL if the SPSCQueue is at capacity.
+**/
+STD_DDS_RESULT SPSCQueueEnqueue(SPSCQueue *queue, void *value);
+
+/**
+ * Add up to n elements to the tail of an SPSCQueue in order, values[0] is
+ * dequeued first. The whole batch is published to the consumer at once. Producer only.
+ * @param queue The SPSCQueue to enqueue the elements into.
+ * @param values An array of at least n element values.
+ * @param n The maximum amount of elements to enqueue.
+ * @return The amount of elements enqueued, fewer than n if the SPSCQueue filled up.
+ * Returns -1 if the SPSCQueue or values array is NULL.
+**/
+size_t SPSCQueueEnqueueN(SPSCQueue *queue, void *const *values, const size_t n);
+
+/**
+ * Remove the head element of an SPSCQueue. Consumer only.
+ * @param queue The SPSCQueue to dequeue an element from.
+ * @return A pointer to the value of the element removed.
+ * Returns NULL if the SPSCQueue is empty.
+**/
+void *SPSCQueueDequeue(SPSCQueue *queue);
+
+/**
+ * Remove up to n elements from the head of an SPSCQueue, values[0] is the
+ * former head. The whole batch is released to the producer at once. Consumer only.
+ * @param queue The SPSCQueue to dequeue the elements from.
+ * @param values An array of at least n elements to store the removed values in.
+ * May be NULL to discard the values.
+ * @param n The maximum amount of elements to remove.
+ * @return The amount of elements removed.
+ * Returns -1 if the SPSCQueue is NULL.
+**/
+size_t SPSCQueueDequeueN(SPSCQueue *queue, void **values, const size_t n);
+
+/**
+ * Get the head element of an SPSCQueue without removing it. Consumer only.
+ * @param queue The SPSCQueue to query.
+ * @return A pointer to the value of the head element.
+ * Returns NULL if the SPSCQueue is empty.
+**/
+void *SPSCQueuePeek(SPSCQueue *queue);
+
+/**
+ * Get the current length of an SPSCQueue.
+ * Only exact when called from the producer or consumer while the other is idle.
+ * @param queue The SPSCQueue to query.
+ * @return The SPSCQueue's length.
+ * Returns -1 if the SPSCQueue is NULL.
+**/
+size_t SPSCQueueGetLength(const SPSCQueue *queue);
+
+/**
+ * Get the capacity of an SPSCQueue.
+ * @param queue The SPSCQueue to query.
+ * @return The maximum amount of elements the SPSCQueue can hold.
+ * Returns -1 if the SPSCQueue is NULL.
+**/
+size_t SPSCQueueGetCapacity(const SPSCQueue *queue);
+
+/**
+ * Free the memory allocated for an SPSCQueue.
+ * DOES NOT free the memory of each element's value.
+ * Neither the producer nor the consumer may be using the SPSCQueue.
+ * @param queue The SPSCQueue to free.
+ * @return STD_DDS_RESULT.
+**/
+STD_DDS_RESULT SPSCQueueFree(SPSCQueue *queue);
+
+#endif // STD_DDS_SPSC_QUEUE_H
@@ -32,6 +32,27 @@ typedef struct stack Stack;
  **/
 Stack *StackInit();
 
+/** 
+ * Initialise and allocate memory for a Stack object whose nodes are
+ * taken from its own NodePool, so pushing and popping reuse nodes instead of calling
+ * malloc and free, and StackFree() releases every slab at once.
+ * @param slabLength The amount of nodes allocated per slab.
+ * A value of 0 uses STD_DDS_NODE_POOL_SLAB_LENGTH.
+ * @return A pointer to the initialised Stack.
+ * Returns NULL if memory allocation failed.
+**/
+Stack *StackInitPooled(const size_t slabLength);
+
+/** 
+ * Initialise and allocate memory for a Stack object that stores its elements
+ * in a contiguous array instead of nodes. The array doubles in capacity when full.
+ * StackGetHead() always returns NULL for an array-backed Stack, use StackPeek().
+ * @param capacity The initial capacity of the Stack's array.
+ * @return A pointer to the initialised Stack.
+ * Returns NULL if memory allocation failed.
+**/
+Stack *StackInitArray(const size_t capacity);
+
 /**
  * Push a new element to the top of a Stack.
  * @param stack The Stack to push the element onto.
@@ -49,6 +70,38 @@ STD_DDS_RESULT StackPush(Stack *stack, void *value);
 **/
 void *StackPop(Stack *stack);
 
+/**
+ * Push several elements onto a Stack in order, values[n - 1] ends up on top.
+ * An array-backed Stack grows at most once and copies the values in one memcpy.
+ * @param stack The Stack to push the elements onto.
+ * @param values An array of at least n element values.
+ * @param n The amount of elements to push.
+ * @return STD_DDS_RESULT.
+**/
+STD_DDS_RESULT StackPushN(Stack *stack, void *const *values, const size_t n);
+
+/**
+ * Remove up to n elements from the top of a Stack.
+ * The values are written in push order, values[0] is the deepest element
+ * removed and values[count - 1] the former top, so StackPushN() restores them.
+ * An array-backed Stack copies the values in one memcpy.
+ * @param stack The Stack to pop the elements from.
+ * @param values An array of at least n elements to store the removed values in.
+ * May be NULL to discard the values.
+ * @param n The maximum amount of elements to remove.
+ * @return The amount of elements removed.
+ * Returns -1 if the Stack is NULL.
+**/
+size_t StackPopN(Stack *stack, void **values, const size_t n);
+
+/**
+ * Get the element on top of a Stack without removing it.
+ * @param stack The Stack to query.
+ * @return A pointer to the value of the top element.
+ * Returns NULL if the Stack is empty.
+**/
+void *StackPeek(const Stack *stack);
+
 /**
  * Get the current length of a Stack.
  * @param stack The Stack to query.
@@ -61,7 +114,7 @@ size_t StackGetLength(const Stack *stack);
  * Get the current head element of a Stack.
  * @param stack The Stack to query.
  * @return The Stack's head element.
- * Returns NULL if the Stack is empty.
+ * Returns NULL if the Stack is empty or array-backed.
 **/
 LinkedNode *StackGetHead(const Stack *stack);
 
@@ -22,13 +22,29 @@
 #include "std_dds_utils.h"
 
 #include "array_list.h"
+#include "seg_array_list.h"
+#include "gap_buffer.h"
 #include "linked_list.h"
+#include "unrolled_list.h"
 #include "d_linked_list.h"
+#include "intrusive_list.h"
 #include "stack.h"
+#include "concurrent_stack.h"
 #include "queue.h"
+#include "spsc_queue.h"
+#include "mpmc_queue.h"
+#include "mpsc_queue.h"
+#include "work_stealing_deque.h"
+#include "priority_queue.h"
+#include "pairing_heap.h"
+#include "radix_heap.h"
+#include "timing_wheel.h"
 #include "hash_map.h"
 #include "graph.h"
 #include "tree.h"
 #include "b_search_tree.h"
+#include "skip_list.h"
+#include "node_pool.h"
+#include "epoch.h"
 
 #endif // STD_DDS_H
@@ -28,8 +28,17 @@ E.g.
 #ifndef STD_DDS_CORE_H
 #define STD_DDS_CORE_H
 
+#include <stddef.h>
+
 #define STD_DDS_MAX_KEY 256
 
+/**
+ * Get a pointer to the struct of a given type that contains member at ptr.
+ * Used by intrusive structures to get from an embedded hook back to its owner.
+**/
+#define STD_DDS_CONTAINER_OF(ptr, type, member) \
+    ((type *)((char *)(ptr) - offsetof(type, member)))
+
 /* RESULT CODES */
 
 /**
@@ -51,10 +60,14 @@ E.g.
 
 #define STD_DDS_NULL_PARAM 100
 
+#define STD_DDS_INVALID_PARAM 110
+
 #define STD_DDS_OUT_OF_BOUNDS 200
 
 #define STD_DDS_NOT_FOUND 210
 
+#define STD_DDS_FULL 220
+
 #define STD_DDS_DUPLICATE_VALUE 300
 
 /**
@@ -67,5 +80,7 @@ E.g.
 
 #define STD_DDS_REALLOC_FAILED 1020
 
+#define STD_DDS_IO_FAILED 1030
+
 #endif // STD_DDS_CORE_H
 
@@ -0,0 +1,302 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+/*
+Include std_dds_inline.h to access the hot std_dds structures directly.
+
+The functions in this header are static inline and DO NOT check for NULL
+parameters or out-of-bounds indices, they are intended for inner loops where
+the caller already guarantees both. The checked functions in each structure's
+own header remain the default API.
+
+E.g.
+    #include "std_dds_inline.h"
+
+    void *value;
+    STD_DDS_ARRAY_LIST_FOR_EACH(list, i, value){
+        ...
+    }
+*/
+
+#ifndef STD_DDS_INLINE_H
+#define STD_DDS_INLINE_H
+
+#include "std_dds_core.h"
+#include "array_list.h"
+#include "seg_array_list.h"
+#include "gap_buffer.h"
+#include "linked_list.h"
+#include "d_linked_list.h"
+#include "stack.h"
+#include "queue.h"
+#include "unrolled_list.h"
+#include "node_pool.h"
+#include "priority_queue.h"
+
+#include <stddef.h>
+
+/* STRUCTURES */
+
+typedef struct arrayList {
+    size_t capacity;
+    size_t length;
+    void **values;
+    ArrayListGrowth growth;
+    size_t mappedBytes;
+    int fd;
+    size_t inlineCapacity;
+    void *inlineValues[];
+} ArrayList;
+
+typedef struct segArrayList {
+    void ***blocks;
+    size_t blockLength;
+    size_t directoryCapacity;
+    size_t length;
+    size_t blockShift;
+    size_t blockMask;
+} SegArrayList;
+
+typedef struct gapBuffer {
+    void **values;
+    size_t capacity;
+    size_t gapStart;
+    size_t gapEnd;
+} GapBuffer;
+
+typedef struct linkedList {
+    LinkedNode *head;
+    LinkedNode *tail;
+    size_t length;
+    int backLinked;
+    NodePool *pool;
+} LinkedList;
+
+typedef struct dLinkedList {
+    DLinkedNode *head;
+    DLinkedNode *tail;
+    size_t length;
+    NodePool *pool;
+} DLinkedList;
+
+typedef struct stack {
+    LinkedNode *head;
+    size_t length;
+    NodePool *pool;
+    void **values;
+    size_t capacity;
+    int arrayBacked;
+} Stack;
+
+typedef struct queue {
+    DLinkedNode *head;
+    DLinkedNode *tail;
+    size_t length;
+    NodePool *pool;
+    void **values;
+    size_t capacity;
+    size_t start;
+    int ringBacked;
+} Queue;
+
+typedef struct unrolledList {
+    UnrolledNode *head;
+    UnrolledNode *tail;
+    size_t length;
+    size_t nodeCapacity;
+} UnrolledList;
+
+typedef struct priorityQueue {
+    PriorityQueueEntry *entries;
+    size_t length;
+    size_t capacity;
+    size_t arity;
+    int (*compare)(const void *a, const void *b);
+} PriorityQueue;
+
+/* ARRAY LIST */
+
+static inline void *ArrayListGetAtUnchecked(const ArrayList *list, const size_t index) {
+    return list->values[index];
+}
+
+static inline void ArrayListSetAtUnchecked(ArrayList *list, const size_t index, void *value) {
+    list->values[index] = value;
+}
+
+static inline void **ArrayListGetValuesUnchecked(const ArrayList *list) {
+    return list->values;
+}
+
+static inline size_t ArrayListGetLengthUnchecked(const ArrayList *list) {
+    return list->length;
+}
+
+static inline size_t ArrayListGetCapacityUnchecked(const ArrayList *list) {
+    return list->capacity;
+}
+
+/**
+ * Iterate over each element of an ArrayList in index order.
+ * index is declared by the macro as a size_t, value must be a declared void * (or compatible) variable.
+**/
+#define STD_DDS_ARRAY_LIST_FOR_EACH(list, index, value) \
+    for (size_t index = 0; index < (list)->length && (((value) = (list)->values[index]), 1); index++)
+
+/* SEGMENTED ARRAY LIST */
+
+static inline void *SegArrayListGetAtUnchecked(const SegArrayList *list, const size_t index) {
+    return list->blocks[index >> list->blockShift][index & list->blockMask];
+}
+
+static inline size_t SegArrayListGetLengthUnchecked(const SegArrayList *list) {
+    return list->length;
+}
+
+/* GAP BUFFER */
+
+static inline void *GapBufferGetAtUnchecked(const GapBuffer *buffer, const size_t index) {
+    return index < buffer->gapStart ? buffer->values[index] : buffer->values[index + buffer->gapEnd - buffer->gapStart];
+}
+
+static inline size_t GapBufferGetLengthUnchecked(const GapBuffer *buffer) {
+    return buffer->capacity - (buffer->gapEnd - buffer->gapStart);
+}
+
+/* LINKED LIST */
+
+static inline LinkedNode *LinkedListGetHeadUnchecked(const LinkedList *list) {
+    return list->head;
+}
+
+static inline LinkedNode *LinkedListGetTailUnchecked(const LinkedList *list) {
+    return list->tail;
+}
+
+static inline size_t LinkedListGetLengthUnchecked(const LinkedList *list) {
+    return list->length;
+}
+
+/**
+ * Iterate over each node of a LinkedList from head to tail.
+ * node is declared by the macro as a LinkedNode *.
+**/
+#define STD_DDS_LINKED_LIST_FOR_EACH(list, node) \
+    for (LinkedNode *node = (list)->head; node != NULL; node = node->next)
+
+/* DOUBLY LINKED LIST */
+
+static inline DLinkedNode *DLinkedListGetHeadUnchecked(const DLinkedList *list) {
+    return list->head;
+}
+
+static inline DLinkedNode *DLinkedListGetTailUnchecked(const DLinkedList *list) {
+    return list->tail;
+}
+
+static inline size_t DLinkedListGetLengthUnchecked(const DLinkedList *list) {
+    return list->length;
+}
+
+/**
+ * Iterate over each node of a DLinkedList from head to tail.
+ * node is declared by the macro as a DLinkedNode *.
+**/
+#define STD_DDS_D_LINKED_LIST_FOR_EACH(list, node) \
+    for (DLinkedNode *node = (list)->head; node != NULL; node = node->next)
+
+/**
+ * Iterate over each node of a DLinkedList from tail to head.
+ * node is declared by the macro as a DLinkedNode *.
+**/
+#define STD_DDS_D_LINKED_LIST_FOR_EACH_REVERSE(list, node) \
+    for (DLinkedNode *node = (list)->tail; node != NULL; node = node->prev)
+
+/* STACK */
+
+static inline LinkedNode *StackGetHeadUnchecked(const Stack *stack) {
+    return stack->head;
+}
+
+static inline size_t StackGetLengthUnchecked(const Stack *stack) {
+    return stack->length;
+}
+
+static inline void *StackPeekUnchecked(const Stack *stack) {
+    return stack->arrayBacked ? stack->values[stack->length - 1] : stack->head->value;
+}
+
+/* QUEUE */
+
+static inline DLinkedNode *QueueGetHeadUnchecked(const Queue *queue) {
+    return queue->head;
+}
+
+static inline DLinkedNode *QueueGetTailUnchecked(const Queue *queue) {
+    return queue->tail;
+}
+
+static inline size_t QueueGetLengthUnchecked(const Queue *queue) {
+    return queue->length;
+}
+
+static inline void *QueuePeekUnchecked(const Queue *queue) {
+    return queue->ringBacked ? queue->values[queue->start] : queue->head->value;
+}
+
+/**
+ * Iterate over each node of a Queue from head (next to dequeue) to tail.
+ * node is declared by the macro as a DLinkedNode *.
+ * A ring-backed Queue has no nodes, so the loop body never runs.
+**/
+#define STD_DDS_QUEUE_FOR_EACH(queue, node) \
+    for (DLinkedNode *node = (queue)->head; node != NULL; node = node->prev)
+
+/* UNROLLED LIST */
+
+static inline UnrolledNode *UnrolledListGetHeadUnchecked(const UnrolledList *list) {
+    return list->head;
+}
+
+static inline UnrolledNode *UnrolledListGetTailUnchecked(const UnrolledList *list) {
+    return list->tail;
+}
+
+static inline size_t UnrolledListGetLengthUnchecked(const UnrolledList *list) {
+    return list->length;
+}
+
+/**
+ * Iterate over each value of an UnrolledList from head to tail.
+ * node is declared by the macro as an UnrolledNode * and index as a size_t,
+ * the current value is node->values[index]. break only leaves the current node.
+**/
+#define STD_DDS_UNROLLED_LIST_FOR_EACH(list, node, index) \
+    for (UnrolledNode *node = (list)->head; node != NULL; node = node->next) \
+        for (size_t index = node->start; index < node->start + node->count; index++)
+
+/* PRIORITY QUEUE */
+
+static inline void *PriorityQueuePeekUnchecked(const PriorityQueue *queue) {
+    return queue->entries[0].value;
+}
+
+static inline size_t PriorityQueueGetLengthUnchecked(const PriorityQueue *queue) {
+    return queue->length;
+}
+
+#endif // STD_DDS_INLINE_H
@@ -0,0 +1,147 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef STD_DDS_TIMING_WHEEL_H
+#define STD_DDS_TIMING_WHEEL_H
+
+#include "std_dds_core.h"
+#include "intrusive_list.h"
+
+#include <stddef.h>
+
+/* 
+Define STD_DDS_TIMING_WHEEL_SLOT_BITS to set the amount of slots of each
+TimingWheel level as a power of two (default 6, 64 slots).
+Define STD_DDS_TIMING_WHEEL_LEVELS to set the amount of TimingWheel levels
+(default 6). Timers further than 2^(SLOT_BITS * LEVELS) ticks away wait in
+the top level and are re-filed until they come within range.
+*/
+
+#ifndef STD_DDS_TIMING_WHEEL_SLOT_BITS
+    #define STD_DDS_TIMING_WHEEL_SLOT_BITS 6
+#endif
+
+#ifndef STD_DDS_TIMING_WHEEL_LEVELS
+    #define STD_DDS_TIMING_WHEEL_LEVELS 6
+#endif
+
+/**
+ * A WheelTimer is embedded in a user's struct to schedule it on a TimingWheel,
+ * no TimingWheel operation allocates or frees memory.
+ * Initialise it with WheelTimerInit() and only change it through the TimingWheel functions.
+**/
+typedef struct wheelTimer {
+    DLinkedHook hook;
+    unsigned long long expiry;
+    IntrusiveList *slot;
+    void (*callback)(struct wheelTimer *timer);
+} WheelTimer;
+
+/**
+ * A TimingWheel is a hierarchical timing wheel, each level's slots cover
+ * 2^STD_DDS_TIMING_WHEEL_SLOT_BITS times as many ticks as the level below.
+ * Scheduling and cancelling take O(1) time, a timer is moved down a level at
+ * most STD_DDS_TIMING_WHEEL_LEVELS - 1 times before it fires.
+**/
+typedef struct timingWheel TimingWheel;
+
+/**
+ * Get a pointer to the struct of a given type that embeds timer as member.
+**/
+#define STD_DDS_WHEEL_TIMER_ENTRY(timer, type, member) STD_DDS_CONTAINER_OF(timer, type, member)
+
+/**
+ * Initialise a WheelTimer as not scheduled.
+ * @param timer The WheelTimer to initialise.
+ * @param callback Called with the timer when it fires. May schedule, cancel or
+ * free any timer, including itself, but must not advance the TimingWheel.
+ * @return STD_DDS_RESULT.
+**/
+STD_DDS_RESULT WheelTimerInit(WheelTimer *timer, void (*callback)(WheelTimer *timer));
+
+/**
+ * Check whether a WheelTimer is currently scheduled on a TimingWheel.
+ * @param timer The WheelTimer to query.
+ * @return 1 if the WheelTimer is scheduled, 0 if it is not.
+ * Returns -1 if the WheelTimer is NULL.
+**/
+int WheelTimerIsScheduled(const WheelTimer *timer);
+
+/**
+ * Initialise and allocate memory for a TimingWheel object.
+ * @param now The current tick of the TimingWheel.
+ * @return A pointer to the initialised TimingWheel.
+ * Returns NULL if memory allocation failed.
+**/
+TimingWheel *TimingWheelInit(const unsigned long long now);
+
+/**
+ * Schedule a WheelTimer to fire a given amount of ticks from now.
+ * A WheelTimer that is already scheduled is rescheduled.
+ * @param wheel The TimingWheel to schedule the WheelTimer on.
+ * @param timer The WheelTimer to schedule.
+ * @param delay The amount of ticks until the WheelTimer fires, a delay of 0
+ * fires it on the next tick.
+ * @return STD_DDS_RESULT.
+**/
+STD_DDS_RESULT TimingWheelSchedule(TimingWheel *wheel, WheelTimer *timer, const unsigned long long delay);
+
+/**
+ * Cancel a scheduled WheelTimer without firing it.
+ * @param wheel The TimingWheel the WheelTimer is scheduled on.
+ * @param timer The WheelTimer to cancel.
+ * @return STD_DDS_RESULT.
+ * Returns STD_DDS_NOT_FOUND if the WheelTimer is not scheduled.
+**/
+STD_DDS_RESULT TimingWheelCancel(TimingWheel *wheel, WheelTimer *timer);
+
+/**
+ * Move a TimingWheel forward, firing every WheelTimer that expires on the way.
+ * The timers due on each tick are unlinked as one batch before any of their
+ * callbacks run, so a callback rescheduling its timer never fires it twice in a tick.
+ * @param wheel The TimingWheel to advance.
+ * @param ticks The amount of ticks to advance by.
+ * @return The amount of WheelTimers fired.
+ * Returns -1 if the TimingWheel is NULL.
+**/
+size_t TimingWheelAdvance(TimingWheel *wheel, const unsigned long long ticks);
+
+/**
+ * Get the current tick of a TimingWheel.
+ * @param wheel The TimingWheel to query.
+ * @return The TimingWheel's current tick.
+ * Returns 0 if the TimingWheel is NULL.
+**/
+unsigned long long TimingWheelGetNow(const TimingWheel *wheel);
+
+/**
+ * Get the amount of WheelTimers scheduled on a TimingWheel.
+ * @param wheel The TimingWheel to query.
+ * @return The TimingWheel's length.
+ * Returns -1 if the TimingWheel is NULL.
+**/
+size_t TimingWheelGetLength(const TimingWheel *wheel);
+
+/**
+ * Free the memory allocated for a TimingWheel.
+ * DOES NOT free the WheelTimers, any still scheduled are left marked as scheduled.
+ * @param wheel The TimingWheel to free.
+ * @return STD_DDS_RESULT.
+**/
+STD_DDS_RESULT TimingWheelFree(TimingWheel *wheel);
+
+#endif // STD_DDS_TIMING_WHEEL_H
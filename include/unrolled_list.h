@@ -0,0 +1,146 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef STD_DDS_UNROLLED_LIST_H
+#define STD_DDS_UNROLLED_LIST_H
+
+#include "std_dds_core.h"
+
+#include <stddef.h>
+
+/* 
+Define STD_DDS_UNROLLED_LIST_NODE_CAPACITY to set the default amount of values
+stored per node when a node capacity of 0 is requested (default 32).
+*/
+
+#ifndef STD_DDS_UNROLLED_LIST_NODE_CAPACITY
+    #define STD_DDS_UNROLLED_LIST_NODE_CAPACITY 32
+#endif
+
+/**
+ * An UnrolledNode stores up to its list's node capacity of values contiguously.
+ * Its values occupy values[start] to values[start + count - 1], a node in a
+ * list is never empty.
+**/
+typedef struct unrolledNode {
+    struct unrolledNode *prev;
+    struct unrolledNode *next;
+    size_t start;
+    size_t count;
+    void *values[];
+} UnrolledNode;
+
+/**
+ * An UnrolledList is a doubly linked list of UnrolledNodes, so sequential
+ * traversal touches one node per block of values instead of one per value.
+**/
+typedef struct unrolledList UnrolledList;
+
+/** 
+ * Initialise and allocate memory for an UnrolledList object.
+ * No node is allocated until the first value is added.
+ * @param nodeCapacity The amount of values stored per node.
+ * A value of 0 uses STD_DDS_UNROLLED_LIST_NODE_CAPACITY.
+ * @return A pointer to the initialised UnrolledList.
+ * Returns NULL if memory allocation failed.
+**/
+UnrolledList *UnrolledListInit(const size_t nodeCapacity);
+
+/** 
+ * Push a new value onto the head of an UnrolledList.
+ * @param list The UnrolledList to push a value onto.
+ * @param value A pointer to the value to push.
+ * @return STD_DDS_RESULT.
+**/
+STD_DDS_RESULT UnrolledListPush(UnrolledList *list, void *value);
+
+/** 
+ * Append a new value onto the tail of an UnrolledList.
+ * @param list The UnrolledList to append a value onto.
+ * @param value A pointer to the value to append.
+ * @return STD_DDS_RESULT.
+**/
+STD_DDS_RESULT UnrolledListAppend(UnrolledList *list, void *value);
+
+/**
+ * Remove the head value of an UnrolledList.
+ * @param list The UnrolledList to pop the head value from.
+ * @return A pointer to the value removed.
+ * Returns NULL if the list is empty.
+**/
+void *UnrolledListPop(UnrolledList *list);
+
+/**
+ * Remove the tail value of an UnrolledList.
+ * @param list The UnrolledList to pop the tail value from.
+ * @return A pointer to the value removed.
+ * Returns NULL if the list is empty.
+**/
+void *UnrolledListPopTail(UnrolledList *list);
+
+/**
+ * Get the value of an element in an UnrolledList based on its index.
+ * Whole nodes are skipped from whichever end of the list is closer.
+ * @param list The UnrolledList to get the element from.
+ * @param index The index of the element to get.
+ * @return A pointer to the value of an element at the specified index.
+ * Returns NULL if out-of-bounds.
+**/
+void *UnrolledListGetAt(const UnrolledList *list, const size_t index);
+
+/**
+ * Set an element of an UnrolledList at an index to a specified value.
+ * @param list The UnrolledList to modify.
+ * @param index The index of the element to modify.
+ * @param value The value to set the element to.
+ * @return STD_DDS_RESULT
+**/
+STD_DDS_RESULT UnrolledListSetAt(UnrolledList *list, const size_t index, void *value);
+
+/**
+ * Get the current length of an UnrolledList.
+ * @param list The UnrolledList to query.
+ * @return The UnrolledList's length.
+ * Returns -1 if the list is NULL.
+**/
+size_t UnrolledListGetLength(const UnrolledList *list);
+
+/**
+ * Get the current head node of an UnrolledList.
+ * @param list The UnrolledList to query.
+ * @return The UnrolledList's head node.
+ * Returns NULL if the list is empty.
+**/
+UnrolledNode *UnrolledListGetHead(const UnrolledList *list);
+
+/**
+ * Get the current tail node of an UnrolledList.
+ * @param list The UnrolledList to query.
+ * @return The UnrolledList's tail node.
+ * Returns NULL if the list is empty.
+**/
+UnrolledNode *UnrolledListGetTail(const UnrolledList *list);
+
+/**
+ * Free the memory allocated for an UnrolledList and its nodes.
+ * DOES NOT free the values of each element.
+ * @param list The UnrolledList to free.
+ * @return STD_DDS_RESULT.
+**/
+STD_DDS_RESULT UnrolledListFree(UnrolledList *list);
+
+#endif // STD_DDS_UNROLLED_LIST_H
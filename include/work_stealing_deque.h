@@ -0,0 +1,88 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef STD_DDS_WORK_STEALING_DEQUE_H
+#define STD_DDS_WORK_STEALING_DEQUE_H
+
+#include "std_dds_core.h"
+
+#include <stddef.h>
+
+/**
+ * A WorkStealingDeque is a Chase-Lev deque for task schedulers. A single owner
+ * thread pushes and pops at the bottom without locks or read-modify-write
+ * atomics, except when taking the last element, while any amount of thief
+ * threads steal from the top with a CAS.
+ * The circular array grows on demand, arrays outgrown while a thief may still
+ * be reading them are reclaimed through epochs, see epoch.h.
+**/
+typedef struct workStealingDeque WorkStealingDeque;
+
+/**
+ * Initialise and allocate memory for a WorkStealingDeque object.
+ * @param capacity The initial capacity of the WorkStealingDeque's array,
+ * rounded up to a power of two. A value of 0 uses a capacity of 16.
+ * @return A pointer to the initialised WorkStealingDeque.
+ * Returns NULL if memory allocation failed.
+**/
+WorkStealingDeque *WorkStealingDequeInit(const size_t capacity);
+
+/**
+ * Add a new element to the bottom of a WorkStealingDeque. Owner only.
+ * @param deque The WorkStealingDeque to push the element onto.
+ * @param value A pointer to the value of the element.
+ * @return STD_DDS_RESULT.
+**/
+STD_DDS_RESULT WorkStealingDequePush(WorkStealingDeque *deque, void *value);
+
+/**
+ * Remove the element at the bottom of a WorkStealingDeque, the most recently pushed. Owner only.
+ * @param deque The WorkStealingDeque to pop an element from.
+ * @return A pointer to the value of the element removed.
+ * Returns NULL if the WorkStealingDeque is empty or a thief took its last element.
+**/
+void *WorkStealingDequePop(WorkStealingDeque *deque);
+
+/**
+ * Remove the element at the top of a WorkStealingDeque, the least recently pushed.
+ * Safe to call from any thread at once.
+ * @param deque The WorkStealingDeque to steal an element from.
+ * @return A pointer to the value of the element removed.
+ * Returns NULL if the WorkStealingDeque is empty or another thread took the element first.
+**/
+void *WorkStealingDequeSteal(WorkStealingDeque *deque);
+
+/**
+ * Get the current length of a WorkStealingDeque.
+ * Only exact while no other thread is pushing, popping or stealing.
+ * @param deque The WorkStealingDeque to query.
+ * @return The WorkStealingDeque's length.
+ * Returns -1 if the WorkStealingDeque is NULL.
+**/
+size_t WorkStealingDequeGetLength(const WorkStealingDeque *deque);
+
+/**
+ * Free the memory allocated for a WorkStealingDeque.
+ * DOES NOT free the memory of each element's value.
+ * No other thread may be using the WorkStealingDeque. Arrays already outgrown
+ * are freed through EpochCollect().
+ * @param deque The WorkStealingDeque to free.
+ * @return STD_DDS_RESULT.
+**/
+STD_DDS_RESULT WorkStealingDequeFree(WorkStealingDeque *deque);
+
+#endif // STD_DDS_WORK_STEALING_DEQUE_H
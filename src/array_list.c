@@ -14,23 +14,294 @@
  * You should have received a copy of the GNU General Public License
  * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
  */
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+    #define _GNU_SOURCE
+#endif
+
 #include "array_list.h"
 #include "std_dds_core.h"
+#include "std_dds_inline.h"
 
 #if defined(STD_DDS_WARNING_MSG) && !defined(STD_DDS_ERROR_MSG)
     #define STD_DDS_ERROR_MSG
 #endif
 
+#include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 #if defined(STD_DDS_ERROR_MSG) || defined(STD_DDS_WARNING_MSG)
     #include <stdio.h>
 #endif
+#if defined(__linux__)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+    #define STD_DDS_ARRAY_LIST_MREMAP
+#endif
+#if defined(__GNUC__) && defined(__x86_64__)
+    #include <immintrin.h>
+    #define STD_DDS_ARRAY_LIST_SIMD
+#endif
+
+#ifdef STD_DDS_ARRAY_LIST_MREMAP
+static STD_DDS_RESULT arrayListRemap(ArrayList *list, const size_t capacity) {
+    size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+    size_t bytes = (sizeof(void *) * capacity + pageSize - 1) / pageSize * pageSize;
+
+    if (bytes == list->mappedBytes) {
+        return STD_DDS_SUCCESS;
+    }
 
-typedef struct arrayList {
-    size_t capacity;
-    size_t length;
     void **values;
-} ArrayList;
+
+    if (bytes == 0) {
+        munmap(list->values, list->mappedBytes);
+        values = NULL;
+    } else if (list->mappedBytes == 0) {
+        values = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (values == MAP_FAILED) {
+            #ifdef STD_DDS_ERROR_MSG
+                fprintf(stderr, "[Error] ArrayList values mmap failed. Unable to map memory of %zu bytes.\n", bytes);
+            #endif
+            return STD_DDS_REALLOC_FAILED;
+        }
+
+        size_t length = list->length < capacity ? list->length : capacity;
+        if (length > 0) {
+            memcpy(values, list->values, sizeof(void *) * length);
+        }
+        free(list->values);
+    } else {
+        values = mremap(list->values, list->mappedBytes, bytes, MREMAP_MAYMOVE);
+        if (values == MAP_FAILED) {
+            #ifdef STD_DDS_ERROR_MSG
+                fprintf(stderr, "[Error] ArrayList values mremap failed. Unable to remap memory of %zu bytes.\n", bytes);
+            #endif
+            return STD_DDS_REALLOC_FAILED;
+        }
+    }
+
+    list->values = values;
+    list->mappedBytes = bytes;
+    list->capacity = capacity;
+
+    return STD_DDS_SUCCESS;
+}
+
+#define STD_DDS_ARRAY_LIST_FILE_MAGIC "STDDDSAL"
+
+/**
+ * The header at the start of a file opened with ArrayListOpenMapped().
+ * The array of elements follows directly after it.
+**/
+typedef struct {
+    char magic[8];
+    uint64_t wordSize;
+    uint64_t length;
+    char reserved[40];
+} ArrayListFileHeader;
+
+static ArrayListFileHeader *arrayListFileHeader(const ArrayList *list) {
+    return (ArrayListFileHeader *)((char *)list->values - sizeof(ArrayListFileHeader));
+}
+
+static STD_DDS_RESULT arrayListRemapFile(ArrayList *list, const size_t capacity) {
+    size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+    size_t bytes = (sizeof(ArrayListFileHeader) + sizeof(void *) * capacity + pageSize - 1) / pageSize * pageSize;
+
+    if (bytes != list->mappedBytes) {
+        char *base = (char *)arrayListFileHeader(list);
+
+        if (bytes > list->mappedBytes && ftruncate(list->fd, (off_t)bytes) != 0) {
+            #ifdef STD_DDS_ERROR_MSG
+                fprintf(stderr, "[Error] ArrayList file ftruncate failed. Unable to extend file to %zu bytes.\n", bytes);
+            #endif
+            return STD_DDS_REALLOC_FAILED;
+        }
+
+        base = mremap(base, list->mappedBytes, bytes, MREMAP_MAYMOVE);
+        if (base == MAP_FAILED) {
+            #ifdef STD_DDS_ERROR_MSG
+                fprintf(stderr, "[Error] ArrayList file mremap failed. Unable to remap memory of %zu bytes.\n", bytes);
+            #endif
+            if (bytes > list->mappedBytes) {
+                if (ftruncate(list->fd, (off_t)list->mappedBytes) != 0) {
+                    #ifdef STD_DDS_ERROR_MSG
+                        fprintf(stderr, "[Error] ArrayList file ftruncate failed. Unable to restore file to %zu bytes.\n", list->mappedBytes);
+                    #endif
+                }
+            }
+            return STD_DDS_REALLOC_FAILED;
+        }
+
+        if (bytes < list->mappedBytes && ftruncate(list->fd, (off_t)bytes) != 0) {
+            #ifdef STD_DDS_ERROR_MSG
+                fprintf(stderr, "[Error] ArrayList file ftruncate failed. Unable to shrink file to %zu bytes.\n", bytes);
+            #endif
+        }
+
+        list->values = (void **)(base + sizeof(ArrayListFileHeader));
+        list->mappedBytes = bytes;
+    }
+
+    list->capacity = capacity;
+
+    return STD_DDS_SUCCESS;
+}
+#endif
+
+/**
+ * Move an ArrayList's heap or mapped array to a new capacity without touching its length.
+ * Arrays at or above STD_DDS_ARRAY_LIST_MMAP_THRESHOLD are kept in their own
+ * mapping so that growing them does not copy.
+**/
+static STD_DDS_RESULT arrayListSetBuffer(ArrayList *list, const size_t capacity) {
+    if (capacity > SIZE_MAX / sizeof(void *)) {
+        #ifdef STD_DDS_ERROR_MSG
+            fprintf(stderr, "[Error] ArrayList capacity of '%zu' elements exceeds the addressable size.\n", capacity);
+        #endif
+        return STD_DDS_REALLOC_FAILED;
+    }
+
+    #ifdef STD_DDS_ARRAY_LIST_MREMAP
+        if (list->fd >= 0) {
+            return arrayListRemapFile(list, capacity);
+        }
+
+        if (list->mappedBytes > 0 || (STD_DDS_ARRAY_LIST_MMAP_THRESHOLD > 0 && sizeof(void *) * capacity >= (size_t)STD_DDS_ARRAY_LIST_MMAP_THRESHOLD)) {
+            return arrayListRemap(list, capacity);
+        }
+    #endif
+
+    if (capacity == 0) {
+        free(list->values);
+        list->values = NULL;
+        list->capacity = 0;
+        return STD_DDS_SUCCESS;
+    }
+
+    void **values = realloc(list->values, sizeof(void *) * capacity);
+    if (values == NULL) {
+        #ifdef STD_DDS_ERROR_MSG
+            fprintf(stderr,"[Error] ArrayList values realloc failed. Unable to reallocate memory of %zu bytes.\n", sizeof(void *) * capacity);
+        #endif
+        return STD_DDS_REALLOC_FAILED;
+    }
+
+    list->values = values;
+    list->capacity = capacity;
+
+    return STD_DDS_SUCCESS;
+}
+
+static void arrayListFreeBuffer(ArrayList *list) {
+    if (list->values == list->inlineValues) {
+        return;
+    }
+
+    #ifdef STD_DDS_ARRAY_LIST_MREMAP
+        if (list->fd >= 0) {
+            arrayListFileHeader(list)->length = list->length;
+            munmap(arrayListFileHeader(list), list->mappedBytes);
+            close(list->fd);
+            list->fd = -1;
+            list->mappedBytes = 0;
+            return;
+        }
+
+        if (list->mappedBytes > 0) {
+            munmap(list->values, list->mappedBytes);
+            list->mappedBytes = 0;
+            return;
+        }
+    #endif
+
+    free(list->values);
+}
+
+/**
+ * Move an ArrayList's array to a new capacity without touching its length.
+ * Lists with inline storage spill to the heap once they outgrow it and
+ * move back when shrunk to fit within it.
+**/
+static STD_DDS_RESULT arrayListSetCapacity(ArrayList *list, const size_t capacity) {
+    if (list->inlineCapacity == 0) {
+        return arrayListSetBuffer(list, capacity);
+    }
+
+    size_t length = list->length < capacity ? list->length : capacity;
+
+    if (capacity <= list->inlineCapacity) {
+        if (list->values != list->inlineValues) {
+            if (length > 0) {
+                memcpy(list->inlineValues, list->values, sizeof(void *) * length);
+            }
+            arrayListFreeBuffer(list);
+            list->values = list->inlineValues;
+        }
+
+        list->capacity = capacity;
+        return STD_DDS_SUCCESS;
+    }
+
+    if (list->values != list->inlineValues) {
+        return arrayListSetBuffer(list, capacity);
+    }
+
+    size_t inlineLength = list->length;
+    size_t inlineCapacity = list->capacity;
+
+    list->values = NULL;
+    list->length = 0;
+    list->capacity = 0;
+
+    STD_DDS_RESULT result = arrayListSetBuffer(list, capacity);
+
+    list->length = inlineLength;
+
+    if (result != STD_DDS_SUCCESS) {
+        list->values = list->inlineValues;
+        list->capacity = inlineCapacity;
+        return result;
+    }
+
+    if (length > 0) {
+        memcpy(list->values, list->inlineValues, sizeof(void *) * length);
+    }
+
+    return STD_DDS_SUCCESS;
+}
+
+/**
+ * Grow an ArrayList's array by its growth policy so that it can hold at
+ * least minCapacity elements.
+**/
+static STD_DDS_RESULT arrayListGrow(ArrayList *list, const size_t minCapacity) {
+    if (minCapacity <= list->capacity) {
+        return STD_DDS_SUCCESS;
+    }
+
+    ArrayListGrowth growth = list->growth;
+    size_t capacity;
+
+    if (growth.limit > 0 && list->capacity >= growth.limit) {
+        capacity = list->capacity + growth.limit;
+    } else {
+        double next = (double)list->capacity * growth.factor + (double)growth.step;
+        capacity = next >= (double)(SIZE_MAX / sizeof(void *)) ? SIZE_MAX / sizeof(void *) : (size_t)next;
+
+        if (growth.limit > 0 && capacity > growth.limit && list->capacity < growth.limit) {
+            capacity = growth.limit;
+        }
+    }
+
+    if (capacity < minCapacity) {
+        capacity = minCapacity;
+    }
+
+    return arrayListSetCapacity(list, capacity);
+}
 
 ArrayList *ArrayListInit(const size_t capacity) {
     ArrayList *list = (ArrayList *)malloc(sizeof(ArrayList));
@@ -41,39 +312,205 @@ ArrayList *ArrayListInit(const size_t capacity) {
         return NULL;
     }
 
-    list->values = malloc(sizeof(void *) * capacity);
-    if (list->values == NULL) {
+    list->values = NULL;
+    list->length = 0;
+    list->capacity = 0;
+    list->mappedBytes = 0;
+    list->fd = -1;
+    list->inlineCapacity = 0;
+    list->growth.factor = 2.0;
+    list->growth.step = 0;
+    list->growth.limit = 0;
+
+    if (capacity > 0 && arrayListSetCapacity(list, capacity) != STD_DDS_SUCCESS) {
+        free(list);
+        return NULL;
+    }
+
+    return list;
+}
+
+ArrayList *ArrayListInitFromArray(void *const *values, const size_t length) {
+    if (values == NULL && length > 0) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] ArrayListInitFromArray failed. Values array is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    ArrayList *list = ArrayListInit(length);
+    if (list == NULL) {
+        return NULL;
+    }
+
+    if (length > 0) {
+        memcpy(list->values, values, sizeof(void *) * length);
+    }
+    list->length = length;
+
+    return list;
+}
+
+ArrayList *ArrayListInitInline(const size_t inlineCapacity) {
+    ArrayList *list = (ArrayList *)malloc(sizeof(ArrayList) + sizeof(void *) * inlineCapacity);
+    if (list == NULL) {
         #ifdef STD_DDS_ERROR_MSG
-            fprintf(stderr, "[Error] ArrayList values malloc failed. Unable to allocate memory of %zu bytes.\n", sizeof(void *) * capacity);
+            fprintf(stderr, "[Error] ArrayList malloc failed. Unable to allocate memory of %zu bytes.\n", sizeof(ArrayList) + sizeof(void *) * inlineCapacity);
         #endif
         return NULL;
     }
 
+    list->values = inlineCapacity > 0 ? list->inlineValues : NULL;
     list->length = 0;
-    list->capacity = capacity;
+    list->capacity = inlineCapacity;
+    list->mappedBytes = 0;
+    list->fd = -1;
+    list->inlineCapacity = inlineCapacity;
+    list->growth.factor = 2.0;
+    list->growth.step = 0;
+    list->growth.limit = 0;
 
     return list;
 }
 
-STD_DDS_RESULT ArrayListResize(ArrayList *list, const size_t capacity) {
-    if (list == NULL) {
+ArrayList *ArrayListOpenMapped(const char *path) {
+    if (path == NULL) {
         #ifdef STD_DDS_WARNING_MSG
-            fprintf(stderr, "[Warning] ArrayListResize failed. ArrayList value is NULL.\n");
+            fprintf(stderr, "[Warning] ArrayListOpenMapped failed. Path value is NULL.\n");
         #endif
-        return STD_DDS_NULL_PARAM;
+        return NULL;
     }
 
-    void **values = realloc(list->values, sizeof(void *) * capacity);
-    if (values == NULL) {
+    #ifndef STD_DDS_ARRAY_LIST_MREMAP
         #ifdef STD_DDS_ERROR_MSG
-            fprintf(stderr,"[Error] ArrayList values realloc failed. Unable to reallocate memory of %zu bytes.\n", sizeof(void *) * capacity);
+            fprintf(stderr, "[Error] ArrayListOpenMapped failed. File-backed ArrayLists are not supported on this platform.\n");
         #endif
-        return STD_DDS_REALLOC_FAILED;
+        return NULL;
+    #else
+        ArrayList *list = ArrayListInit(0);
+        if (list == NULL) {
+            return NULL;
+        }
+
+        int fd = open(path, O_RDWR | O_CREAT, 0644);
+        if (fd < 0) {
+            #ifdef STD_DDS_ERROR_MSG
+                fprintf(stderr, "[Error] ArrayList file open failed. Unable to open '%s'.\n", path);
+            #endif
+            free(list);
+            return NULL;
+        }
+
+        struct stat st;
+        if (fstat(fd, &st) != 0) {
+            #ifdef STD_DDS_ERROR_MSG
+                fprintf(stderr, "[Error] ArrayList file fstat failed. Unable to query '%s'.\n", path);
+            #endif
+            close(fd);
+            free(list);
+            return NULL;
+        }
+
+        size_t bytes = (size_t)st.st_size;
+        int created = bytes == 0;
+
+        if (created) {
+            bytes = (size_t)sysconf(_SC_PAGESIZE);
+            if (ftruncate(fd, (off_t)bytes) != 0) {
+                #ifdef STD_DDS_ERROR_MSG
+                    fprintf(stderr, "[Error] ArrayList file ftruncate failed. Unable to extend '%s' to %zu bytes.\n", path, bytes);
+                #endif
+                close(fd);
+                free(list);
+                return NULL;
+            }
+        } else if (bytes < sizeof(ArrayListFileHeader)) {
+            #ifdef STD_DDS_ERROR_MSG
+                fprintf(stderr, "[Error] ArrayListOpenMapped failed. '%s' is not an ArrayList file.\n", path);
+            #endif
+            close(fd);
+            free(list);
+            return NULL;
+        }
+
+        char *base = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (base == MAP_FAILED) {
+            #ifdef STD_DDS_ERROR_MSG
+                fprintf(stderr, "[Error] ArrayList file mmap failed. Unable to map '%s' of %zu bytes.\n", path, bytes);
+            #endif
+            close(fd);
+            free(list);
+            return NULL;
+        }
+
+        ArrayListFileHeader *header = (ArrayListFileHeader *)base;
+
+        if (created) {
+            memcpy(header->magic, STD_DDS_ARRAY_LIST_FILE_MAGIC, sizeof(header->magic));
+            header->wordSize = sizeof(void *);
+            header->length = 0;
+        } else if (memcmp(header->magic, STD_DDS_ARRAY_LIST_FILE_MAGIC, sizeof(header->magic)) != 0 || header->wordSize != sizeof(void *)) {
+            #ifdef STD_DDS_ERROR_MSG
+                fprintf(stderr, "[Error] ArrayListOpenMapped failed. '%s' is not an ArrayList file for this platform.\n", path);
+            #endif
+            munmap(base, bytes);
+            close(fd);
+            free(list);
+            return NULL;
+        }
+
+        list->values = (void **)(base + sizeof(ArrayListFileHeader));
+        list->mappedBytes = bytes;
+        list->fd = fd;
+        list->capacity = (bytes - sizeof(ArrayListFileHeader)) / sizeof(void *);
+        list->length = header->length < list->capacity ? header->length : list->capacity;
+
+        return list;
+    #endif
+}
+
+STD_DDS_RESULT ArrayListSync(ArrayList *list) {
+    if (list == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] ArrayListSync failed. ArrayList value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
     }
 
-    list->values = values;
+    #ifdef STD_DDS_ARRAY_LIST_MREMAP
+        if (list->fd >= 0) {
+            ArrayListFileHeader *header = arrayListFileHeader(list);
+            header->length = list->length;
 
-    list->capacity = capacity;
+            if (msync(header, list->mappedBytes, MS_SYNC) != 0) {
+                #ifdef STD_DDS_ERROR_MSG
+                    fprintf(stderr, "[Error] ArrayList msync failed. Unable to write %zu bytes to its file.\n", list->mappedBytes);
+                #endif
+                return STD_DDS_IO_FAILED;
+            }
+
+            return STD_DDS_SUCCESS;
+        }
+    #endif
+
+    #ifdef STD_DDS_WARNING_MSG
+        fprintf(stderr, "[Warning] ArrayListSync failed. ArrayList is not file-backed.\n");
+    #endif
+    return STD_DDS_INVALID_PARAM;
+}
+
+STD_DDS_RESULT ArrayListResize(ArrayList *list, const size_t capacity) {
+    if (list == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] ArrayListResize failed. ArrayList value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    STD_DDS_RESULT result = arrayListSetCapacity(list, capacity);
+    if (result != STD_DDS_SUCCESS) {
+        return result;
+    }
 
     if (list->length > list->capacity) {
         #ifdef STD_DDS_WARNING_MSG
@@ -85,6 +522,56 @@ STD_DDS_RESULT ArrayListResize(ArrayList *list, const size_t capacity) {
     return STD_DDS_SUCCESS;
 }
 
+STD_DDS_RESULT ArrayListSetGrowth(ArrayList *list, const ArrayListGrowth growth) {
+    if (list == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] ArrayListSetGrowth failed. ArrayList value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if (!(growth.factor >= 1.0)) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] ArrayListSetGrowth failed. Growth factor '%f' is less than 1.0.\n", growth.factor);
+        #endif
+        return STD_DDS_INVALID_PARAM;
+    }
+
+    list->growth = growth;
+
+    return STD_DDS_SUCCESS;
+}
+
+STD_DDS_RESULT ArrayListReserve(ArrayList *list, const size_t capacity) {
+    if (list == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] ArrayListReserve failed. ArrayList value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if (capacity <= list->capacity) {
+        return STD_DDS_SUCCESS;
+    }
+
+    return arrayListSetCapacity(list, capacity);
+}
+
+STD_DDS_RESULT ArrayListShrinkToFit(ArrayList *list) {
+    if (list == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] ArrayListShrinkToFit failed. ArrayList value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if (list->length == list->capacity) {
+        return STD_DDS_SUCCESS;
+    }
+
+    return arrayListSetCapacity(list, list->length);
+}
+
 void *ArrayListGetAt(const ArrayList *list, const int index) {
     if (list == NULL) {
         #ifdef STD_DDS_WARNING_MSG
@@ -126,27 +613,58 @@ STD_DDS_RESULT ArrayListSetAt(ArrayList *list, const int index, void *value) {
 STD_DDS_RESULT ArrayListFill(ArrayList *list, void *value){
     if (list == NULL) {
         #ifdef STD_DDS_WARNING_MSG
-            fprintf(stderr, "[Warning] ArrayListPush failed. ArrayList value is NULL.\n");
+            fprintf(stderr, "[Warning] ArrayListFill failed. ArrayList value is NULL.\n");
         #endif
         return STD_DDS_NULL_PARAM;
     }
 
-    STD_DDS_RESULT result;
+    if (list->capacity == 0) {
+        return STD_DDS_SUCCESS;
+    }
 
-    for(int i = 0; i < list->capacity; i++){
-        if(i >= list->length){
-            result = ArrayListAppend(list, value);
-            if(result != STD_DDS_SUCCESS){
-                return result;
-            }
-        } else {
-            result = ArrayListSetAt(list, i, value);
-            if(result != STD_DDS_SUCCESS){
-                return result;
-            }
+    if (value == NULL) {
+        memset(list->values, 0, sizeof(void *) * list->capacity);
+    } else {
+        for (size_t i = 0; i < list->capacity; i++) {
+            list->values[i] = value;
         }
     }
 
+    list->length = list->capacity;
+
+    return STD_DDS_SUCCESS;
+}
+
+STD_DDS_RESULT ArrayListFillPattern(ArrayList *list, void *const *pattern, const size_t patternLength){
+    if (list == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] ArrayListFillPattern failed. ArrayList value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if (pattern == NULL || patternLength == 0) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] ArrayListFillPattern failed. Pattern value is NULL or empty.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if (list->capacity == 0) {
+        return STD_DDS_SUCCESS;
+    }
+
+    size_t filled = patternLength < list->capacity ? patternLength : list->capacity;
+    memcpy(list->values, pattern, sizeof(void *) * filled);
+
+    while (filled < list->capacity) {
+        size_t copy = filled < list->capacity - filled ? filled : list->capacity - filled;
+        memcpy(list->values + filled, list->values, sizeof(void *) * copy);
+        filled += copy;
+    }
+
+    list->length = list->capacity;
+
     return STD_DDS_SUCCESS;
 }
 
@@ -159,7 +677,7 @@ STD_DDS_RESULT ArrayListPush(ArrayList *list, void *value) {
     }
 
     if (list->length >= list->capacity) {
-        STD_DDS_RESULT result = ArrayListResize(list, list->capacity * 2);
+        STD_DDS_RESULT result = arrayListGrow(list, list->length + 1);
         if(result != STD_DDS_SUCCESS){
             return result;
         }
@@ -184,7 +702,7 @@ STD_DDS_RESULT ArrayListAppend(ArrayList *list, void *value) {
     }
 
     if (list->length >= list->capacity) {
-        STD_DDS_RESULT result = ArrayListResize(list, list->capacity * 2);
+        STD_DDS_RESULT result = arrayListGrow(list, list->length + 1);
         if(result != STD_DDS_SUCCESS){
             return result;
         }
@@ -197,6 +715,43 @@ STD_DDS_RESULT ArrayListAppend(ArrayList *list, void *value) {
     return STD_DDS_SUCCESS;
 }
 
+STD_DDS_RESULT ArrayListAppendArray(ArrayList *list, void *const *values, const size_t length) {
+    if (list == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] ArrayListAppendArray failed. ArrayList value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if (length == 0) {
+        return STD_DDS_SUCCESS;
+    }
+
+    if (values == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] ArrayListAppendArray failed. Values array is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if (length > SIZE_MAX / sizeof(void *) - list->length) {
+        #ifdef STD_DDS_ERROR_MSG
+            fprintf(stderr, "[Error] ArrayListAppendArray failed. Appending '%zu' elements exceeds the addressable size.\n", length);
+        #endif
+        return STD_DDS_REALLOC_FAILED;
+    }
+
+    STD_DDS_RESULT result = arrayListGrow(list, list->length + length);
+    if (result != STD_DDS_SUCCESS) {
+        return result;
+    }
+
+    memcpy(list->values + list->length, values, sizeof(void *) * length);
+    list->length += length;
+
+    return STD_DDS_SUCCESS;
+}
+
 STD_DDS_RESULT ArrayListInsertAt(ArrayList *list, const int index, void *value) {
     if (list == NULL) {
         #ifdef STD_DDS_WARNING_MSG
@@ -206,7 +761,7 @@ STD_DDS_RESULT ArrayListInsertAt(ArrayList *list, const int index, void *value)
     }
 
     if (list->length >= list->capacity) {
-        STD_DDS_RESULT result = ArrayListResize(list, list->capacity * 2);
+        STD_DDS_RESULT result = arrayListGrow(list, list->length + 1);
         if(result != STD_DDS_SUCCESS){
             return result;
         }
@@ -268,6 +823,188 @@ void *ArrayListRemoveAt(ArrayList *list, const int index) {
     return value;
 }
 
+#ifdef STD_DDS_ARRAY_LIST_SIMD
+__attribute__((target("avx2")))
+static size_t arrayListFindAVX2(void *const *values, const size_t length, const void *value) {
+    __m256i needle = _mm256_set1_epi64x((long long)(uintptr_t)value);
+    size_t i = 0;
+
+    for (; i + 4 <= length; i += 4) {
+        __m256i block = _mm256_loadu_si256((const __m256i *)(values + i));
+        int mask = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(block, needle)));
+        if (mask != 0) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+
+    for (; i < length; i++) {
+        if (values[i] == value) {
+            return i;
+        }
+    }
+
+    return length;
+}
+
+__attribute__((target("sse4.1")))
+static size_t arrayListFindSSE4(void *const *values, const size_t length, const void *value) {
+    __m128i needle = _mm_set1_epi64x((long long)(uintptr_t)value);
+    size_t i = 0;
+
+    for (; i + 2 <= length; i += 2) {
+        __m128i block = _mm_loadu_si128((const __m128i *)(values + i));
+        int mask = _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpeq_epi64(block, needle)));
+        if (mask != 0) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+
+    if (i < length && values[i] == value) {
+        return i;
+    }
+
+    return length;
+}
+
+__attribute__((target("avx2")))
+static size_t arrayListCountAVX2(void *const *values, const size_t length, const void *value) {
+    __m256i needle = _mm256_set1_epi64x((long long)(uintptr_t)value);
+    __m256i counts = _mm256_setzero_si256();
+    size_t i = 0;
+
+    for (; i + 4 <= length; i += 4) {
+        __m256i block = _mm256_loadu_si256((const __m256i *)(values + i));
+        counts = _mm256_sub_epi64(counts, _mm256_cmpeq_epi64(block, needle));
+    }
+
+    long long lanes[4];
+    _mm256_storeu_si256((__m256i *)lanes, counts);
+    size_t count = (size_t)(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+
+    for (; i < length; i++) {
+        count += values[i] == value;
+    }
+
+    return count;
+}
+
+__attribute__((target("sse4.1")))
+static size_t arrayListCountSSE4(void *const *values, const size_t length, const void *value) {
+    __m128i needle = _mm_set1_epi64x((long long)(uintptr_t)value);
+    __m128i counts = _mm_setzero_si128();
+    size_t i = 0;
+
+    for (; i + 2 <= length; i += 2) {
+        __m128i block = _mm_loadu_si128((const __m128i *)(values + i));
+        counts = _mm_sub_epi64(counts, _mm_cmpeq_epi64(block, needle));
+    }
+
+    size_t count = (size_t)(_mm_cvtsi128_si64(counts) + _mm_extract_epi64(counts, 1));
+
+    if (i < length) {
+        count += values[i] == value;
+    }
+
+    return count;
+}
+#endif
+
+static size_t arrayListFind(void *const *values, const size_t length, const void *value) {
+    #ifdef STD_DDS_ARRAY_LIST_SIMD
+        if (__builtin_cpu_supports("avx2")) {
+            return arrayListFindAVX2(values, length, value);
+        }
+        if (__builtin_cpu_supports("sse4.1")) {
+            return arrayListFindSSE4(values, length, value);
+        }
+    #endif
+
+    for (size_t i = 0; i < length; i++) {
+        if (values[i] == value) {
+            return i;
+        }
+    }
+
+    return length;
+}
+
+static size_t arrayListCount(void *const *values, const size_t length, const void *value) {
+    #ifdef STD_DDS_ARRAY_LIST_SIMD
+        if (__builtin_cpu_supports("avx2")) {
+            return arrayListCountAVX2(values, length, value);
+        }
+        if (__builtin_cpu_supports("sse4.1")) {
+            return arrayListCountSSE4(values, length, value);
+        }
+    #endif
+
+    size_t count = 0;
+
+    for (size_t i = 0; i < length; i++) {
+        count += values[i] == value;
+    }
+
+    return count;
+}
+
+size_t ArrayListIndexOf(const ArrayList *list, const void *value) {
+    if (list == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] ArrayListIndexOf failed. ArrayList value is NULL.\n");
+        #endif
+        return -1;
+    }
+
+    size_t index = arrayListFind(list->values, list->length, value);
+    if (index >= list->length) {
+        return -1;
+    }
+
+    return index;
+}
+
+size_t ArrayListCount(const ArrayList *list, const void *value) {
+    if (list == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] ArrayListCount failed. ArrayList value is NULL.\n");
+        #endif
+        return -1;
+    }
+
+    return arrayListCount(list->values, list->length, value);
+}
+
+size_t ArrayListRemoveIf(ArrayList *list, int (*predicate)(void *value, void *ctx), void *ctx) {
+    if (list == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] ArrayListRemoveIf failed. ArrayList value is NULL.\n");
+        #endif
+        return -1;
+    }
+
+    if (predicate == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] ArrayListRemoveIf failed. Predicate value is NULL.\n");
+        #endif
+        return -1;
+    }
+
+    size_t kept = 0;
+
+    for (size_t i = 0; i < list->length; i++) {
+        void *value = list->values[i];
+        if (!predicate(value, ctx)) {
+            list->values[kept] = value;
+            kept++;
+        }
+    }
+
+    size_t removed = list->length - kept;
+    list->length = kept;
+
+    return removed;
+}
+
 size_t ArrayListGetLength(const ArrayList *list) {
     if (list == NULL) {
         #ifdef STD_DDS_WARNING_MSG
@@ -299,7 +1036,7 @@ STD_DDS_RESULT ArrayListFree(ArrayList *list) {
         return STD_DDS_NULL_PARAM;
     }
 
-    free(list->values);
+    arrayListFreeBuffer(list);
 
     free(list);
 
@@ -0,0 +1,230 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "concurrent_stack.h"
+#include "std_dds_core.h"
+#include "epoch.h"
+
+#if defined(STD_DDS_WARNING_MSG) && !defined(STD_DDS_ERROR_MSG)
+    #define STD_DDS_ERROR_MSG
+#endif
+
+#include <stdlib.h>
+#include <stdatomic.h>
+#if defined(STD_DDS_ERROR_MSG) || defined(STD_DDS_WARNING_MSG)
+    #include <stdio.h>
+#endif
+
+typedef struct concurrentStackNode {
+    void *value;
+    struct concurrentStackNode *next;
+} ConcurrentStackNode;
+
+/* head and length sit on separate cache lines so that the length counter
+   does not add to the contention on head. */
+struct concurrentStack {
+    _Alignas(64) _Atomic(ConcurrentStackNode *) head;
+    _Alignas(64) atomic_size_t length;
+};
+
+static ConcurrentStackNode *concurrentStackNodeInit(void *value){
+    ConcurrentStackNode *node = (ConcurrentStackNode *)malloc(sizeof(ConcurrentStackNode));
+    if(node == NULL){
+        #ifdef STD_DDS_ERROR_MSG
+            fprintf(stderr, "[Error] ConcurrentStackNode malloc failed. Unable to allocate memory of %zu bytes.\n", sizeof(ConcurrentStackNode));
+        #endif
+        return NULL;
+    }
+
+    node->value = value;
+    node->next = NULL;
+
+    return node;
+}
+
+// Link a chain of nodes onto the top of the stack with one CAS. The length is
+// counted first so a concurrent pop can never take it below zero.
+static void concurrentStackLink(ConcurrentStack *stack, ConcurrentStackNode *first, ConcurrentStackNode *last, size_t n){
+    atomic_fetch_add_explicit(&stack->length, n, memory_order_relaxed);
+
+    ConcurrentStackNode *head = atomic_load_explicit(&stack->head, memory_order_relaxed);
+    do {
+        last->next = head;
+    } while(!atomic_compare_exchange_weak_explicit(&stack->head, &head, first, memory_order_release, memory_order_relaxed));
+}
+
+ConcurrentStack *ConcurrentStackInit(void){
+    ConcurrentStack *stack = (ConcurrentStack *)aligned_alloc(_Alignof(ConcurrentStack), sizeof(ConcurrentStack));
+    if(stack == NULL){
+        #ifdef STD_DDS_ERROR_MSG
+            fprintf(stderr, "[Error] ConcurrentStack aligned_alloc failed. Unable to allocate memory of %zu bytes.\n", sizeof(ConcurrentStack));
+        #endif
+        return NULL;
+    }
+
+    atomic_init(&stack->head, NULL);
+    atomic_init(&stack->length, 0);
+
+    return stack;
+}
+
+STD_DDS_RESULT ConcurrentStackPush(ConcurrentStack *stack, void *value){
+    if(stack == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] ConcurrentStackPush failed. ConcurrentStack value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    ConcurrentStackNode *node = concurrentStackNodeInit(value);
+    if(node == NULL){
+        return STD_DDS_MALLOC_FAILED;
+    }
+
+    concurrentStackLink(stack, node, node, 1);
+
+    return STD_DDS_SUCCESS;
+}
+
+STD_DDS_RESULT ConcurrentStackPushN(ConcurrentStack *stack, void *const *values, const size_t n){
+    if(stack == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] ConcurrentStackPushN failed. ConcurrentStack value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if(values == NULL && n > 0){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] ConcurrentStackPushN failed. Values array is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if(n == 0){
+        return STD_DDS_SUCCESS;
+    }
+
+    // Build the chain privately from the bottom element up, values[n - 1] first.
+    ConcurrentStackNode *first = NULL;
+    ConcurrentStackNode *last = NULL;
+    for(size_t i = 0; i < n; i++){
+        ConcurrentStackNode *node = concurrentStackNodeInit(values[i]);
+        if(node == NULL){
+            while(first != NULL){
+                ConcurrentStackNode *next = first->next;
+                free(first);
+                first = next;
+            }
+            return STD_DDS_MALLOC_FAILED;
+        }
+
+        node->next = first;
+        first = node;
+        if(last == NULL){
+            last = node;
+        }
+    }
+
+    concurrentStackLink(stack, first, last, n);
+
+    return STD_DDS_SUCCESS;
+}
+
+void *ConcurrentStackPop(ConcurrentStack *stack){
+    if(stack == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] ConcurrentStackPop failed. ConcurrentStack value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    if(EpochEnter() != STD_DDS_SUCCESS){
+        return NULL;
+    }
+
+    // The epoch keeps head allocated while head->next is read, so it cannot be
+    // popped, freed and pushed again at the same address under this CAS.
+    ConcurrentStackNode *head = atomic_load_explicit(&stack->head, memory_order_acquire);
+    while(head != NULL &&
+        !atomic_compare_exchange_weak_explicit(&stack->head, &head, head->next, memory_order_acquire, memory_order_acquire)){
+    }
+
+    if(head == NULL){
+        EpochExit();
+        return NULL;
+    }
+
+    atomic_fetch_sub_explicit(&stack->length, 1, memory_order_relaxed);
+
+    void *value = head->value;
+    EpochRetire(head, free);
+    EpochExit();
+
+    return value;
+}
+
+void *ConcurrentStackPeek(ConcurrentStack *stack){
+    if(stack == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] ConcurrentStackPeek failed. ConcurrentStack value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    if(EpochEnter() != STD_DDS_SUCCESS){
+        return NULL;
+    }
+
+    ConcurrentStackNode *head = atomic_load_explicit(&stack->head, memory_order_acquire);
+    void *value = head != NULL ? head->value : NULL;
+
+    EpochExit();
+
+    return value;
+}
+
+size_t ConcurrentStackGetLength(const ConcurrentStack *stack){
+    if(stack == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] ConcurrentStackGetLength failed. ConcurrentStack value is NULL.\n");
+        #endif
+        return -1;
+    }
+
+    return atomic_load_explicit(&stack->length, memory_order_relaxed);
+}
+
+STD_DDS_RESULT ConcurrentStackFree(ConcurrentStack *stack){
+    if(stack == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] ConcurrentStackFree failed. ConcurrentStack value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    ConcurrentStackNode *node = atomic_load(&stack->head);
+    while(node != NULL){
+        ConcurrentStackNode *next = node->next;
+        free(node);
+        node = next;
+    }
+
+    free(stack);
+
+    return STD_DDS_SUCCESS;
+}
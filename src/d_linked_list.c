@@ -17,6 +17,8 @@
 
 #include "d_linked_list.h"
 #include "std_dds_core.h"
+#include "std_dds_inline.h"
+#include "node_pool.h"
 
 #if defined(STD_DDS_WARNING_MSG) && !defined(STD_DDS_ERROR_MSG)
     #define STD_DDS_ERROR_MSG
@@ -27,12 +29,6 @@
     #include <stdio.h>
 #endif
 
-typedef struct dLinkedList {
-    DLinkedNode *head;
-    DLinkedNode *tail;
-    size_t length;
-} DLinkedList;
-
 DLinkedNode *DLinkedNodeInit(void *value){
     DLinkedNode *node = (DLinkedNode *)malloc(sizeof(DLinkedNode));
     if(node == NULL){
@@ -49,7 +45,32 @@ DLinkedNode *DLinkedNodeInit(void *value){
     return node;
 }
 
-DLinkedList *DLinkedListInit(){
+static DLinkedNode *dLinkedListNodeInit(const DLinkedList *list, void *value){
+    if(list->pool == NULL){
+        return DLinkedNodeInit(value);
+    }
+
+    DLinkedNode *node = (DLinkedNode *)NodePoolAlloc(list->pool);
+    if(node == NULL){
+        return NULL;
+    }
+
+    node->value = value;
+    node->next = NULL;
+    node->prev = NULL;
+
+    return node;
+}
+
+static void dLinkedListNodeFree(const DLinkedList *list, DLinkedNode *node){
+    if(list->pool != NULL){
+        NodePoolRelease(list->pool, node);
+    } else {
+        free(node);
+    }
+}
+
+static DLinkedList *dLinkedListInit(int pooled, size_t slabLength){
     DLinkedList *list = (DLinkedList *)malloc(sizeof(DLinkedList));
     if(list == NULL){
         #ifdef STD_DDS_ERROR_MSG
@@ -61,10 +82,27 @@ DLinkedList *DLinkedListInit(){
     list->head = NULL;
     list->tail = NULL;
     list->length = 0;
+    list->pool = NULL;
+
+    if(pooled){
+        list->pool = NodePoolInit(sizeof(DLinkedNode), slabLength);
+        if(list->pool == NULL){
+            free(list);
+            return NULL;
+        }
+    }
 
     return list;
 }
 
+DLinkedList *DLinkedListInit(){
+    return dLinkedListInit(0, 0);
+}
+
+DLinkedList *DLinkedListInitPooled(const size_t slabLength){
+    return dLinkedListInit(1, slabLength);
+}
+
 STD_DDS_RESULT DLinkedListPush(DLinkedList *list, void *value){
     if(list == NULL){
         #ifdef STD_DDS_WARNING_MSG
@@ -73,7 +111,7 @@ STD_DDS_RESULT DLinkedListPush(DLinkedList *list, void *value){
         return STD_DDS_NULL_PARAM;
     }
 
-    DLinkedNode *node = DLinkedNodeInit(value);
+    DLinkedNode *node = dLinkedListNodeInit(list, value);
     if(node == NULL){
         return STD_DDS_MALLOC_FAILED;
     }
@@ -102,7 +140,7 @@ STD_DDS_RESULT DLinkedListAppend(DLinkedList *list, void *value){
         return STD_DDS_NULL_PARAM;
     }
 
-    DLinkedNode *node = DLinkedNodeInit(value);
+    DLinkedNode *node = dLinkedListNodeInit(list, value);
     if(node == NULL){
         return STD_DDS_MALLOC_FAILED;
     }
@@ -155,7 +193,7 @@ void *DLinkedListPop(DLinkedList *list){
 
     void *value = currHead->value;
 
-    free(currHead);
+    dLinkedListNodeFree(list, currHead);
 
     return value;
 }
@@ -191,11 +229,325 @@ void *DLinkedListPopTail(DLinkedList *list){
 
     void *value = currTail->value;
 
-    free(currTail);
+    dLinkedListNodeFree(list, currTail);
+
+    return value;
+}
+
+static DLinkedNode *dLinkedListInsert(DLinkedList *list, DLinkedNode *prev, DLinkedNode *next, void *value){
+    DLinkedNode *node = dLinkedListNodeInit(list, value);
+    if(node == NULL){
+        return NULL;
+    }
+
+    node->prev = prev;
+    node->next = next;
+
+    if(prev != NULL){
+        prev->next = node;
+    } else {
+        list->head = node;
+    }
+
+    if(next != NULL){
+        next->prev = node;
+    } else {
+        list->tail = node;
+    }
+
+    list->length++;
+
+    return node;
+}
+
+DLinkedNode *DLinkedListInsertAfter(DLinkedList *list, DLinkedNode *node, void *value){
+    if(list == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] DLinkedListInsertAfter failed. DLinkedList value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    if(node == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] DLinkedListInsertAfter failed. DLinkedNode value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    return dLinkedListInsert(list, node, node->next, value);
+}
+
+DLinkedNode *DLinkedListInsertBefore(DLinkedList *list, DLinkedNode *node, void *value){
+    if(list == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] DLinkedListInsertBefore failed. DLinkedList value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    if(node == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] DLinkedListInsertBefore failed. DLinkedNode value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    return dLinkedListInsert(list, node->prev, node, value);
+}
+
+void *DLinkedListUnlink(DLinkedList *list, DLinkedNode *node){
+    if(list == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] DLinkedListUnlink failed. DLinkedList value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    if(node == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] DLinkedListUnlink failed. DLinkedNode value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    if(node->prev != NULL){
+        node->prev->next = node->next;
+    } else {
+        list->head = node->next;
+    }
+
+    if(node->next != NULL){
+        node->next->prev = node->prev;
+    } else {
+        list->tail = node->prev;
+    }
+
+    list->length--;
+
+    void *value = node->value;
+
+    dLinkedListNodeFree(list, node);
 
     return value;
 }
 
+STD_DDS_RESULT DLinkedListSplice(DLinkedList *dst, DLinkedList *src){
+    if(dst == NULL || src == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] DLinkedListSplice failed. DLinkedList value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if(dst == src || (dst->pool == NULL) != (src->pool == NULL)){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] DLinkedListSplice failed. DLinkedLists must be distinct and both pooled or both unpooled.\n");
+        #endif
+        return STD_DDS_INVALID_PARAM;
+    }
+
+    if(dst->pool != src->pool){
+        STD_DDS_RESULT result = NodePoolMerge(dst->pool, src->pool);
+        if(result != STD_DDS_SUCCESS){
+            return result;
+        }
+
+        NodePoolFree(src->pool);
+        NodePoolRetain(dst->pool);
+        src->pool = dst->pool;
+    }
+
+    if(src->head == NULL){
+        return STD_DDS_SUCCESS;
+    }
+
+    if(dst->tail != NULL){
+        dst->tail->next = src->head;
+        src->head->prev = dst->tail;
+    } else {
+        dst->head = src->head;
+    }
+
+    dst->tail = src->tail;
+    dst->length += src->length;
+
+    src->head = NULL;
+    src->tail = NULL;
+    src->length = 0;
+
+    return STD_DDS_SUCCESS;
+}
+
+DLinkedList *DLinkedListSplitAt(DLinkedList *list, DLinkedNode *node){
+    if(list == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] DLinkedListSplitAt failed. DLinkedList value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    if(node == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] DLinkedListSplitAt failed. DLinkedNode value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    DLinkedList *split = dLinkedListInit(0, 0);
+    if(split == NULL){
+        return NULL;
+    }
+
+    if(list->pool != NULL){
+        NodePoolRetain(list->pool);
+        split->pool = list->pool;
+    }
+
+    // Walk from the cut towards the tail and from the head towards the cut at
+    // the same time, stopping as soon as either side has been counted.
+    size_t count = 0;
+    DLinkedNode *forward = node;
+    DLinkedNode *fromHead = list->head;
+    while(forward != NULL && fromHead != node){
+        forward = forward->next;
+        fromHead = fromHead->next;
+        count++;
+    }
+
+    size_t splitLength = forward == NULL ? count : list->length - count;
+
+    split->head = node;
+    split->tail = list->tail;
+    split->length = splitLength;
+
+    list->tail = node->prev;
+    if(list->tail != NULL){
+        list->tail->next = NULL;
+    } else {
+        list->head = NULL;
+    }
+    list->length -= splitLength;
+
+    node->prev = NULL;
+
+    return split;
+}
+
+/* Bottom-up merge sort working on next links only: natural runs are fed into
+   bins where bins[i] holds a sorted run built from 2^i input runs, merging
+   like a binary counter. 64 bins cover any list that fits in memory. */
+#define D_LINKED_LIST_SORT_BINS 64
+
+static DLinkedNode *dLinkedListMerge(DLinkedNode *a, DLinkedNode *b, int (*compare)(const void *, const void *)){
+    DLinkedNode head;
+    DLinkedNode *tail = &head;
+
+    while(a != NULL && b != NULL){
+        if(compare(a->value, b->value) <= 0){
+            tail->next = a;
+            a = a->next;
+        } else {
+            tail->next = b;
+            b = b->next;
+        }
+        tail = tail->next;
+    }
+
+    tail->next = a != NULL ? a : b;
+
+    return head.next;
+}
+
+// Detach the natural run at the start of *list, reversing it if strictly descending.
+static DLinkedNode *dLinkedListTakeRun(DLinkedNode **list, int (*compare)(const void *, const void *)){
+    DLinkedNode *run = *list;
+    DLinkedNode *last = run;
+
+    if(last->next != NULL && compare(last->value, last->next->value) > 0){
+        DLinkedNode *reversed = NULL;
+        DLinkedNode *node = run;
+        do {
+            DLinkedNode *next = node->next;
+            node->next = reversed;
+            reversed = node;
+            node = next;
+        } while(node != NULL && compare(reversed->value, node->value) > 0);
+
+        *list = node;
+        return reversed;
+    }
+
+    while(last->next != NULL && compare(last->value, last->next->value) <= 0){
+        last = last->next;
+    }
+
+    *list = last->next;
+    last->next = NULL;
+
+    return run;
+}
+
+STD_DDS_RESULT DLinkedListSort(DLinkedList *list, int (*compare)(const void *a, const void *b)){
+    if(list == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] DLinkedListSort failed. DLinkedList value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if(compare == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] DLinkedListSort failed. Compare function is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if(list->length < 2){
+        return STD_DDS_SUCCESS;
+    }
+
+    DLinkedNode *bins[D_LINKED_LIST_SORT_BINS] = {NULL};
+    size_t binCount = 0;
+    DLinkedNode *remaining = list->head;
+
+    while(remaining != NULL){
+        DLinkedNode *run = dLinkedListTakeRun(&remaining, compare);
+
+        // Older bins hold earlier nodes, so they go first to keep the sort stable.
+        size_t i = 0;
+        while(i < binCount && bins[i] != NULL){
+            run = dLinkedListMerge(bins[i], run, compare);
+            bins[i] = NULL;
+            i++;
+        }
+
+        bins[i] = run;
+        if(i == binCount){
+            binCount++;
+        }
+    }
+
+    DLinkedNode *sorted = NULL;
+    for(size_t i = 0; i < binCount; i++){
+        if(bins[i] != NULL){
+            sorted = sorted == NULL ? bins[i] : dLinkedListMerge(bins[i], sorted, compare);
+        }
+    }
+
+    // Restore the prev links and the tail.
+    DLinkedNode *prev = NULL;
+    for(DLinkedNode *node = sorted; node != NULL; node = node->next){
+        node->prev = prev;
+        prev = node;
+    }
+
+    list->head = sorted;
+    list->tail = prev;
+
+    return STD_DDS_SUCCESS;
+}
+
 size_t DLinkedListGetLength(const DLinkedList *list){
     if(list == NULL){
         #ifdef STD_DDS_WARNING_MSG
@@ -237,11 +589,25 @@ STD_DDS_RESULT DLinkedListFree(DLinkedList *list){
         return STD_DDS_NULL_PARAM;
     }
 
-    DLinkedNode *node = list->head;
-    while(node != NULL){
-        DLinkedNode *next = node->next;
-        free(node);
-        node = next;
+    if(list->pool != NULL){
+        // A pool shared with another list only gets this list's nodes back.
+        if(NodePoolGetRefCount(list->pool) > 1){
+            DLinkedNode *node = list->head;
+            while(node != NULL){
+                DLinkedNode *next = node->next;
+                NodePoolRelease(list->pool, node);
+                node = next;
+            }
+        }
+
+        NodePoolFree(list->pool);
+    } else {
+        DLinkedNode *node = list->head;
+        while(node != NULL){
+            DLinkedNode *next = node->next;
+            free(node);
+            node = next;
+        }
     }
 
     free(list);
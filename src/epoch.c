@@ -0,0 +1,241 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "epoch.h"
+#include "std_dds_core.h"
+
+#if defined(STD_DDS_WARNING_MSG) && !defined(STD_DDS_ERROR_MSG)
+    #define STD_DDS_ERROR_MSG
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#if defined(STD_DDS_ERROR_MSG) || defined(STD_DDS_WARNING_MSG)
+    #include <stdio.h>
+#endif
+
+typedef struct epochRetired {
+    void *ptr;
+    void (*freeFunc)(void *);
+    size_t epoch;
+} EpochRetired;
+
+/* One record per registered thread. state is 0 when the thread is outside any
+   epoch-protected section, otherwise the epoch it entered in shifted left by
+   one with the low bit set. Records are never freed, only reused. */
+typedef struct epochRecord {
+    atomic_size_t state;
+    atomic_int inUse;
+    struct epochRecord *next;
+    size_t depth;
+    EpochRetired *retired;
+    size_t retiredLength;
+    size_t retiredCapacity;
+    size_t sinceCollect;
+} EpochRecord;
+
+static atomic_size_t globalEpoch = 1;
+static _Atomic(EpochRecord *) records = NULL;
+static _Thread_local EpochRecord *localRecord = NULL;
+
+static EpochRecord *epochRecord(void){
+    if(localRecord != NULL){
+        return localRecord;
+    }
+
+    for(EpochRecord *record = atomic_load(&records); record != NULL; record = record->next){
+        int expected = 0;
+        if(atomic_load_explicit(&record->inUse, memory_order_relaxed) == 0 &&
+            atomic_compare_exchange_strong(&record->inUse, &expected, 1)){
+            record->depth = 0;
+            localRecord = record;
+            return record;
+        }
+    }
+
+    EpochRecord *record = (EpochRecord *)malloc(sizeof(EpochRecord));
+    if(record == NULL){
+        #ifdef STD_DDS_ERROR_MSG
+            fprintf(stderr, "[Error] EpochRecord malloc failed. Unable to allocate memory of %zu bytes.\n", sizeof(EpochRecord));
+        #endif
+        return NULL;
+    }
+
+    atomic_init(&record->state, 0);
+    atomic_init(&record->inUse, 1);
+    record->depth = 0;
+    record->retired = NULL;
+    record->retiredLength = 0;
+    record->retiredCapacity = 0;
+    record->sinceCollect = 0;
+
+    EpochRecord *head = atomic_load(&records);
+    do {
+        record->next = head;
+    } while(!atomic_compare_exchange_weak(&records, &head, record));
+
+    localRecord = record;
+    return record;
+}
+
+// Advance the global epoch if every pinned thread has observed the current one.
+static size_t epochTryAdvance(void){
+    size_t epoch = atomic_load(&globalEpoch);
+
+    for(EpochRecord *record = atomic_load(&records); record != NULL; record = record->next){
+        size_t state = atomic_load(&record->state);
+        if(state != 0 && (state >> 1) != epoch){
+            return epoch;
+        }
+    }
+
+    if(atomic_compare_exchange_strong(&globalEpoch, &epoch, epoch + 1)){
+        return epoch + 1;
+    }
+
+    return epoch;
+}
+
+// Free the retired pointers no thread can still reach. They are stored in retire order,
+// so their epochs are non-decreasing and the freeable ones form a prefix.
+static void epochFreeRetired(EpochRecord *record, size_t epoch){
+    size_t freed = 0;
+    while(freed < record->retiredLength && record->retired[freed].epoch + 2 <= epoch){
+        record->retired[freed].freeFunc(record->retired[freed].ptr);
+        freed++;
+    }
+
+    if(freed > 0){
+        memmove(record->retired, record->retired + freed, sizeof(EpochRetired) * (record->retiredLength - freed));
+        record->retiredLength -= freed;
+    }
+}
+
+STD_DDS_RESULT EpochEnter(void){
+    EpochRecord *record = epochRecord();
+    if(record == NULL){
+        return STD_DDS_MALLOC_FAILED;
+    }
+
+    if(record->depth++ > 0){
+        return STD_DDS_SUCCESS;
+    }
+
+    // Publish the epoch, then make sure it did not move before the publish became visible.
+    size_t epoch;
+    do {
+        epoch = atomic_load(&globalEpoch);
+        atomic_store(&record->state, (epoch << 1) | 1);
+    } while(atomic_load(&globalEpoch) != epoch);
+
+    return STD_DDS_SUCCESS;
+}
+
+STD_DDS_RESULT EpochExit(void){
+    EpochRecord *record = localRecord;
+    if(record == NULL || record->depth == 0){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] EpochExit failed. The calling thread is not inside an epoch.\n");
+        #endif
+        return STD_DDS_INVALID_PARAM;
+    }
+
+    if(--record->depth == 0){
+        atomic_store_explicit(&record->state, 0, memory_order_release);
+    }
+
+    return STD_DDS_SUCCESS;
+}
+
+STD_DDS_RESULT EpochRetire(void *ptr, void (*freeFunc)(void *)){
+    if(ptr == NULL || freeFunc == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] EpochRetire failed. Pointer or free function is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    EpochRecord *record = epochRecord();
+    if(record == NULL){
+        return STD_DDS_MALLOC_FAILED;
+    }
+
+    if(record->retiredLength == record->retiredCapacity){
+        size_t capacity = record->retiredCapacity == 0 ? STD_DDS_EPOCH_COLLECT_THRESHOLD : record->retiredCapacity * 2;
+        EpochRetired *retired = (EpochRetired *)realloc(record->retired, sizeof(EpochRetired) * capacity);
+        if(retired == NULL){
+            #ifdef STD_DDS_ERROR_MSG
+                fprintf(stderr, "[Error] Epoch retire list realloc failed. Unable to allocate memory of %zu bytes.\n", sizeof(EpochRetired) * capacity);
+            #endif
+            return STD_DDS_REALLOC_FAILED;
+        }
+
+        record->retired = retired;
+        record->retiredCapacity = capacity;
+    }
+
+    record->retired[record->retiredLength].ptr = ptr;
+    record->retired[record->retiredLength].freeFunc = freeFunc;
+    record->retired[record->retiredLength].epoch = atomic_load(&globalEpoch);
+    record->retiredLength++;
+
+    if(++record->sinceCollect >= STD_DDS_EPOCH_COLLECT_THRESHOLD){
+        EpochCollect();
+    }
+
+    return STD_DDS_SUCCESS;
+}
+
+size_t EpochCollect(void){
+    EpochRecord *record = epochRecord();
+    if(record == NULL){
+        return 0;
+    }
+
+    record->sinceCollect = 0;
+    epochFreeRetired(record, epochTryAdvance());
+
+    return record->retiredLength;
+}
+
+STD_DDS_RESULT EpochThreadRelease(void){
+    EpochRecord *record = localRecord;
+    if(record == NULL){
+        return STD_DDS_SUCCESS;
+    }
+
+    if(record->depth > 0){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] EpochThreadRelease failed. The calling thread is inside an epoch.\n");
+        #endif
+        return STD_DDS_INVALID_PARAM;
+    }
+
+    localRecord = NULL;
+    atomic_store(&record->inUse, 0);
+
+    return STD_DDS_SUCCESS;
+}
+
+STD_DDS_RESULT EpochDrain(void){
+    for(EpochRecord *record = atomic_load(&records); record != NULL; record = record->next){
+        epochFreeRetired(record, (size_t)-1);
+    }
+
+    return STD_DDS_SUCCESS;
+}
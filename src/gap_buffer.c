@@ -0,0 +1,310 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "gap_buffer.h"
+#include "std_dds_core.h"
+#include "std_dds_inline.h"
+
+#if defined(STD_DDS_WARNING_MSG) && !defined(STD_DDS_ERROR_MSG)
+    #define STD_DDS_ERROR_MSG
+#endif
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(STD_DDS_ERROR_MSG) || defined(STD_DDS_WARNING_MSG)
+    #include <stdio.h>
+#endif
+
+GapBuffer *GapBufferInit(const size_t capacity) {
+    GapBuffer *buffer = (GapBuffer *)malloc(sizeof(GapBuffer));
+    if (buffer == NULL) {
+        #ifdef STD_DDS_ERROR_MSG
+            fprintf(stderr, "[Error] GapBuffer malloc failed. Unable to allocate memory of %zu bytes.\n", sizeof(GapBuffer));
+        #endif
+        return NULL;
+    }
+
+    buffer->values = NULL;
+    if (capacity > 0) {
+        buffer->values = malloc(sizeof(void *) * capacity);
+        if (buffer->values == NULL) {
+            #ifdef STD_DDS_ERROR_MSG
+                fprintf(stderr, "[Error] GapBuffer values malloc failed. Unable to allocate memory of %zu bytes.\n", sizeof(void *) * capacity);
+            #endif
+            free(buffer);
+            return NULL;
+        }
+    }
+
+    buffer->capacity = capacity;
+    buffer->gapStart = 0;
+    buffer->gapEnd = capacity;
+
+    return buffer;
+}
+
+/**
+ * Move the gap of a GapBuffer so that it starts at index.
+ * Only the elements between the old and new gap position are moved.
+**/
+static void gapBufferMoveGap(GapBuffer *buffer, const size_t index) {
+    size_t gapSize = buffer->gapEnd - buffer->gapStart;
+
+    if (index < buffer->gapStart) {
+        size_t count = buffer->gapStart - index;
+        memmove(buffer->values + index + gapSize, buffer->values + index, sizeof(void *) * count);
+    } else if (index > buffer->gapStart) {
+        size_t count = index - buffer->gapStart;
+        memmove(buffer->values + buffer->gapStart, buffer->values + buffer->gapEnd, sizeof(void *) * count);
+    }
+
+    buffer->gapStart = index;
+    buffer->gapEnd = index + gapSize;
+}
+
+/**
+ * Double the capacity of a GapBuffer, growing its gap.
+**/
+static STD_DDS_RESULT gapBufferGrow(GapBuffer *buffer) {
+    if (buffer->capacity > SIZE_MAX / sizeof(void *) / 2) {
+        #ifdef STD_DDS_ERROR_MSG
+            fprintf(stderr, "[Error] GapBuffer capacity of '%zu' elements cannot grow further.\n", buffer->capacity);
+        #endif
+        return STD_DDS_REALLOC_FAILED;
+    }
+
+    size_t capacity = buffer->capacity < 4 ? 4 : buffer->capacity * 2;
+
+    void **values = realloc(buffer->values, sizeof(void *) * capacity);
+    if (values == NULL) {
+        #ifdef STD_DDS_ERROR_MSG
+            fprintf(stderr, "[Error] GapBuffer values realloc failed. Unable to reallocate memory of %zu bytes.\n", sizeof(void *) * capacity);
+        #endif
+        return STD_DDS_REALLOC_FAILED;
+    }
+
+    size_t tail = buffer->capacity - buffer->gapEnd;
+    memmove(values + capacity - tail, values + buffer->gapEnd, sizeof(void *) * tail);
+
+    buffer->values = values;
+    buffer->gapEnd = capacity - tail;
+    buffer->capacity = capacity;
+
+    return STD_DDS_SUCCESS;
+}
+
+STD_DDS_RESULT GapBufferMoveCursor(GapBuffer *buffer, const size_t index) {
+    if (buffer == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] GapBufferMoveCursor failed. GapBuffer value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    size_t length = buffer->capacity - (buffer->gapEnd - buffer->gapStart);
+
+    if (index > length) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] Cursor '%zu' is out-of-bounds for GapBuffer with a length of '%zu'.\n", index, length);
+        #endif
+        return STD_DDS_OUT_OF_BOUNDS;
+    }
+
+    gapBufferMoveGap(buffer, index);
+
+    return STD_DDS_SUCCESS;
+}
+
+size_t GapBufferGetCursor(const GapBuffer *buffer) {
+    if (buffer == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] GapBufferGetCursor failed. GapBuffer value is NULL.\n");
+        #endif
+        return -1;
+    }
+
+    return buffer->gapStart;
+}
+
+STD_DDS_RESULT GapBufferInsert(GapBuffer *buffer, void *value) {
+    if (buffer == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] GapBufferInsert failed. GapBuffer value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if (buffer->gapStart == buffer->gapEnd) {
+        STD_DDS_RESULT result = gapBufferGrow(buffer);
+        if (result != STD_DDS_SUCCESS) {
+            return result;
+        }
+    }
+
+    buffer->values[buffer->gapStart] = value;
+    buffer->gapStart++;
+
+    return STD_DDS_SUCCESS;
+}
+
+STD_DDS_RESULT GapBufferInsertAt(GapBuffer *buffer, const size_t index, void *value) {
+    STD_DDS_RESULT result = GapBufferMoveCursor(buffer, index);
+    if (result != STD_DDS_SUCCESS) {
+        return result;
+    }
+
+    return GapBufferInsert(buffer, value);
+}
+
+void *GapBufferRemove(GapBuffer *buffer) {
+    if (buffer == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] GapBufferRemove failed. GapBuffer value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    if (buffer->gapEnd >= buffer->capacity) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] Unable to remove from GapBuffer as its cursor is at the end.\n");
+        #endif
+        return NULL;
+    }
+
+    void *value = buffer->values[buffer->gapEnd];
+    buffer->gapEnd++;
+
+    return value;
+}
+
+void *GapBufferRemoveBefore(GapBuffer *buffer) {
+    if (buffer == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] GapBufferRemoveBefore failed. GapBuffer value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    if (buffer->gapStart == 0) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] Unable to remove from GapBuffer as its cursor is at the start.\n");
+        #endif
+        return NULL;
+    }
+
+    buffer->gapStart--;
+
+    return buffer->values[buffer->gapStart];
+}
+
+void *GapBufferRemoveAt(GapBuffer *buffer, const size_t index) {
+    if (buffer == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] GapBufferRemoveAt failed. GapBuffer value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    size_t length = buffer->capacity - (buffer->gapEnd - buffer->gapStart);
+
+    if (index >= length) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] Index '%zu' is out-of-bounds for GapBuffer with a length of '%zu'.\n", index, length);
+        #endif
+        return NULL;
+    }
+
+    gapBufferMoveGap(buffer, index);
+
+    return GapBufferRemove(buffer);
+}
+
+void *GapBufferGetAt(const GapBuffer *buffer, const size_t index) {
+    if (buffer == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] GapBufferGetAt failed. GapBuffer value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    size_t length = buffer->capacity - (buffer->gapEnd - buffer->gapStart);
+
+    if (index >= length) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] Index '%zu' is out-of-bounds for GapBuffer with a length of '%zu'.\n", index, length);
+        #endif
+        return NULL;
+    }
+
+    if (index < buffer->gapStart) {
+        return buffer->values[index];
+    }
+
+    return buffer->values[index + buffer->gapEnd - buffer->gapStart];
+}
+
+STD_DDS_RESULT GapBufferSetAt(GapBuffer *buffer, const size_t index, void *value) {
+    if (buffer == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] GapBufferSetAt failed. GapBuffer value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    size_t length = buffer->capacity - (buffer->gapEnd - buffer->gapStart);
+
+    if (index >= length) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] Index '%zu' is out-of-bounds for GapBuffer with a length of '%zu'.\n", index, length);
+        #endif
+        return STD_DDS_OUT_OF_BOUNDS;
+    }
+
+    if (index < buffer->gapStart) {
+        buffer->values[index] = value;
+    } else {
+        buffer->values[index + buffer->gapEnd - buffer->gapStart] = value;
+    }
+
+    return STD_DDS_SUCCESS;
+}
+
+size_t GapBufferGetLength(const GapBuffer *buffer) {
+    if (buffer == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] GapBufferGetLength failed. GapBuffer value is NULL.\n");
+        #endif
+        return -1;
+    }
+
+    return buffer->capacity - (buffer->gapEnd - buffer->gapStart);
+}
+
+STD_DDS_RESULT GapBufferFree(GapBuffer *buffer) {
+    if (buffer == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] GapBufferFree failed. GapBuffer value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    free(buffer->values);
+
+    free(buffer);
+
+    return STD_DDS_SUCCESS;
+}
@@ -0,0 +1,264 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "intrusive_list.h"
+#include "std_dds_core.h"
+
+#if defined(STD_DDS_WARNING_MSG) && !defined(STD_DDS_ERROR_MSG)
+    #define STD_DDS_ERROR_MSG
+#endif
+
+#include <stdlib.h>
+#if defined(STD_DDS_ERROR_MSG) || defined(STD_DDS_WARNING_MSG)
+    #include <stdio.h>
+#endif
+
+static void intrusiveListLink(IntrusiveList *list, DLinkedHook *prev, DLinkedHook *hook, DLinkedHook *next){
+    hook->prev = prev;
+    hook->next = next;
+
+    if(prev != NULL){
+        prev->next = hook;
+    } else {
+        list->head = hook;
+    }
+
+    if(next != NULL){
+        next->prev = hook;
+    } else {
+        list->tail = hook;
+    }
+
+    list->length++;
+}
+
+static void intrusiveListUnlink(IntrusiveList *list, DLinkedHook *hook){
+    if(hook->prev != NULL){
+        hook->prev->next = hook->next;
+    } else {
+        list->head = hook->next;
+    }
+
+    if(hook->next != NULL){
+        hook->next->prev = hook->prev;
+    } else {
+        list->tail = hook->prev;
+    }
+
+    hook->prev = NULL;
+    hook->next = NULL;
+    list->length--;
+}
+
+STD_DDS_RESULT IntrusiveListInit(IntrusiveList *list){
+    if(list == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] IntrusiveListInit failed. IntrusiveList value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    list->head = NULL;
+    list->tail = NULL;
+    list->length = 0;
+
+    return STD_DDS_SUCCESS;
+}
+
+STD_DDS_RESULT IntrusiveListPush(IntrusiveList *list, DLinkedHook *hook){
+    if(list == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] IntrusiveListPush failed. IntrusiveList value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if(hook == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] IntrusiveListPush failed. DLinkedHook value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    intrusiveListLink(list, NULL, hook, list->head);
+
+    return STD_DDS_SUCCESS;
+}
+
+STD_DDS_RESULT IntrusiveListAppend(IntrusiveList *list, DLinkedHook *hook){
+    if(list == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] IntrusiveListAppend failed. IntrusiveList value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if(hook == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] IntrusiveListAppend failed. DLinkedHook value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    intrusiveListLink(list, list->tail, hook, NULL);
+
+    return STD_DDS_SUCCESS;
+}
+
+STD_DDS_RESULT IntrusiveListInsertAfter(IntrusiveList *list, DLinkedHook *position, DLinkedHook *hook){
+    if(list == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] IntrusiveListInsertAfter failed. IntrusiveList value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if(position == NULL || hook == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] IntrusiveListInsertAfter failed. DLinkedHook value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    intrusiveListLink(list, position, hook, position->next);
+
+    return STD_DDS_SUCCESS;
+}
+
+STD_DDS_RESULT IntrusiveListInsertBefore(IntrusiveList *list, DLinkedHook *position, DLinkedHook *hook){
+    if(list == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] IntrusiveListInsertBefore failed. IntrusiveList value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if(position == NULL || hook == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] IntrusiveListInsertBefore failed. DLinkedHook value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    intrusiveListLink(list, position->prev, hook, position);
+
+    return STD_DDS_SUCCESS;
+}
+
+DLinkedHook *IntrusiveListPop(IntrusiveList *list){
+    if(list == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] IntrusiveListPop failed. IntrusiveList value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    DLinkedHook *hook = list->head;
+
+    if(hook == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] Unable to pop element from IntrusiveList as its current length is 0.\n");
+        #endif
+        return NULL;
+    }
+
+    intrusiveListUnlink(list, hook);
+
+    return hook;
+}
+
+DLinkedHook *IntrusiveListPopTail(IntrusiveList *list){
+    if(list == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] IntrusiveListPopTail failed. IntrusiveList value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    DLinkedHook *hook = list->tail;
+
+    if(hook == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] Unable to pop tail element from IntrusiveList as its current length is 0.\n");
+        #endif
+        return NULL;
+    }
+
+    intrusiveListUnlink(list, hook);
+
+    return hook;
+}
+
+STD_DDS_RESULT IntrusiveListRemove(IntrusiveList *list, DLinkedHook *hook){
+    if(list == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] IntrusiveListRemove failed. IntrusiveList value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if(hook == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] IntrusiveListRemove failed. DLinkedHook value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if(list->length < 1){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] Unable to remove element from IntrusiveList as its current length is 0.\n");
+        #endif
+        return STD_DDS_NOT_FOUND;
+    }
+
+    intrusiveListUnlink(list, hook);
+
+    return STD_DDS_SUCCESS;
+}
+
+size_t IntrusiveListGetLength(const IntrusiveList *list){
+    if(list == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] IntrusiveListGetLength failed. IntrusiveList value is NULL.\n");
+        #endif
+        return -1;
+    }
+
+    return list->length;
+}
+
+DLinkedHook *IntrusiveListGetHead(const IntrusiveList *list){
+    if(list == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] IntrusiveListGetHead failed. IntrusiveList value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    return list->head;
+}
+
+DLinkedHook *IntrusiveListGetTail(const IntrusiveList *list){
+    if(list == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] IntrusiveListGetTail failed. IntrusiveList value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    return list->tail;
+}
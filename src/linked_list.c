@@ -17,6 +17,8 @@
 
 #include "linked_list.h"
 #include "std_dds_core.h"
+#include "std_dds_inline.h"
+#include "node_pool.h"
 
 #if defined(STD_DDS_WARNING_MSG) && !defined(STD_DDS_ERROR_MSG)
     #define STD_DDS_ERROR_MSG
@@ -27,12 +29,6 @@
     #include <stdio.h>
 #endif
 
-typedef struct linkedList {
-    LinkedNode *head;
-    LinkedNode *tail;
-    size_t length;
-} LinkedList;
-
 LinkedNode *LinkedNodeInit(void *value){
     LinkedNode *node = (LinkedNode *)malloc(sizeof(LinkedNode));
     if(node == NULL){
@@ -48,7 +44,49 @@ LinkedNode *LinkedNodeInit(void *value){
     return node;
 }
 
-LinkedList *LinkedListInit(){
+/* Node layout used by back-linked lists. The LinkedNode must stay the first
+   member so that a LinkedNode * can be cast back to a LinkedBackNode *. */
+typedef struct linkedBackNode {
+    LinkedNode node;
+    LinkedNode *prev;
+} LinkedBackNode;
+
+#define LINKED_BACK_NODE(node) ((LinkedBackNode *)(node))
+
+static LinkedNode *linkedListNodeInit(const LinkedList *list, void *value){
+    if(list->pool == NULL && !list->backLinked){
+        return LinkedNodeInit(value);
+    }
+
+    size_t size = list->backLinked ? sizeof(LinkedBackNode) : sizeof(LinkedNode);
+    LinkedNode *node = list->pool != NULL ? (LinkedNode *)NodePoolAlloc(list->pool) : (LinkedNode *)malloc(size);
+    if(node == NULL){
+        #ifdef STD_DDS_ERROR_MSG
+            if(list->pool == NULL){
+                fprintf(stderr, "[Error] LinkedNode malloc failed. Unable to allocate memory of %zu bytes.\n", size);
+            }
+        #endif
+        return NULL;
+    }
+
+    node->value = value;
+    node->next = NULL;
+    if(list->backLinked){
+        LINKED_BACK_NODE(node)->prev = NULL;
+    }
+
+    return node;
+}
+
+static void linkedListNodeFree(const LinkedList *list, LinkedNode *node){
+    if(list->pool != NULL){
+        NodePoolRelease(list->pool, node);
+    } else {
+        free(node);
+    }
+}
+
+static LinkedList *linkedListInit(int backLinked, int pooled, size_t slabLength){
     LinkedList *list = (LinkedList *)malloc(sizeof(LinkedList));
     if(list == NULL){
         #ifdef STD_DDS_ERROR_MSG
@@ -60,10 +98,36 @@ LinkedList *LinkedListInit(){
     list->head = NULL;
     list->tail = NULL;
     list->length = 0;
+    list->backLinked = backLinked;
+    list->pool = NULL;
+
+    if(pooled){
+        list->pool = NodePoolInit(backLinked ? sizeof(LinkedBackNode) : sizeof(LinkedNode), slabLength);
+        if(list->pool == NULL){
+            free(list);
+            return NULL;
+        }
+    }
 
     return list;
 }
 
+LinkedList *LinkedListInit(){
+    return linkedListInit(0, 0, 0);
+}
+
+LinkedList *LinkedListInitBackLinked(){
+    return linkedListInit(1, 0, 0);
+}
+
+LinkedList *LinkedListInitPooled(const size_t slabLength){
+    return linkedListInit(0, 1, slabLength);
+}
+
+LinkedList *LinkedListInitBackLinkedPooled(const size_t slabLength){
+    return linkedListInit(1, 1, slabLength);
+}
+
 STD_DDS_RESULT LinkedListPush(LinkedList *list, void *value){
     if(list == NULL){
         #ifdef STD_DDS_WARNING_MSG
@@ -72,13 +136,16 @@ STD_DDS_RESULT LinkedListPush(LinkedList *list, void *value){
         return STD_DDS_NULL_PARAM;
     }
 
-    LinkedNode *node = LinkedNodeInit(value);
+    LinkedNode *node = linkedListNodeInit(list, value);
     if(node == NULL){
         return STD_DDS_MALLOC_FAILED;
     }
     
     if(list->head != NULL){
         node->next = list->head;
+        if(list->backLinked){
+            LINKED_BACK_NODE(list->head)->prev = node;
+        }
     }
 
     list->head = node;
@@ -100,13 +167,16 @@ STD_DDS_RESULT LinkedListAppend(LinkedList *list, void *value){
         return STD_DDS_NULL_PARAM;
     }
 
-    LinkedNode *node = LinkedNodeInit(value);
+    LinkedNode *node = linkedListNodeInit(list, value);
     if(node == NULL){
         return STD_DDS_MALLOC_FAILED;
     }
 
     if(list->tail != NULL){
         list->tail->next = node;
+        if(list->backLinked){
+            LINKED_BACK_NODE(node)->prev = list->tail;
+        }
     }
 
     list->tail = node;
@@ -142,11 +212,13 @@ void *LinkedListPop(LinkedList *list){
 
     if(list->head == NULL){
         list->tail = NULL;
+    } else if(list->backLinked){
+        LINKED_BACK_NODE(list->head)->prev = NULL;
     }
 
     void *value = currHead->value;
 
-    free(currHead);
+    linkedListNodeFree(list, currHead);
 
     return value;
 }
@@ -168,30 +240,199 @@ void *LinkedListPopTail(LinkedList *list){
         return NULL;
     }
     
-    LinkedNode *newTail = list->head;
-
-    if(currTail != newTail){
+    LinkedNode *newTail = NULL;
 
-        while(newTail->next != list->tail){
+    if(list->backLinked){
+        newTail = LINKED_BACK_NODE(currTail)->prev;
+    } else if(list->head != currTail){
+        newTail = list->head;
+        while(newTail->next != currTail){
             newTail = newTail->next;
         }
-
     }
 
-    if(newTail == list->head && list->head == list->tail) {
+    list->tail = newTail;
+    if(newTail == NULL){
         list->head = NULL;
+    } else {
+        newTail->next = NULL;
     }
-
-    list->tail = newTail;
-    list->tail->next = NULL;
     list->length--;
 
     void *value = currTail->value;
 
-    free(currTail);
+    linkedListNodeFree(list, currTail);
 
     return value;
+}
 
+size_t LinkedListPopTailN(LinkedList *list, void **values, const size_t n){
+    if(list == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] LinkedListPopTailN failed. LinkedList value is NULL.\n");
+        #endif
+        return -1;
+    }
+
+    size_t count = n < list->length ? n : list->length;
+    if(count == 0){
+        return 0;
+    }
+
+    // Locate the node that becomes the new tail: walk back from the tail when
+    // back-linked, otherwise forward from the head. NULL empties the list.
+    LinkedNode *newTail = NULL;
+    if(count < list->length){
+        if(list->backLinked){
+            newTail = list->tail;
+            for(size_t i = 0; i < count; i++){
+                newTail = LINKED_BACK_NODE(newTail)->prev;
+            }
+        } else {
+            newTail = list->head;
+            for(size_t i = list->length - count - 1; i > 0; i--){
+                newTail = newTail->next;
+            }
+        }
+    }
+
+    LinkedNode *node = newTail == NULL ? list->head : newTail->next;
+
+    list->tail = newTail;
+    if(newTail == NULL){
+        list->head = NULL;
+    } else {
+        newTail->next = NULL;
+    }
+    list->length -= count;
+
+    // The detached run is in head to tail order, values[0] is the old tail.
+    for(size_t i = count; i > 0; i--){
+        LinkedNode *next = node->next;
+        if(values != NULL){
+            values[i - 1] = node->value;
+        }
+        linkedListNodeFree(list, node);
+        node = next;
+    }
+
+    return count;
+}
+
+/* Bottom-up merge sort working on next links only: natural runs are fed into
+   bins where bins[i] holds a sorted run built from 2^i input runs, merging
+   like a binary counter. 64 bins cover any list that fits in memory. */
+#define LINKED_LIST_SORT_BINS 64
+
+static LinkedNode *linkedListMerge(LinkedNode *a, LinkedNode *b, int (*compare)(const void *, const void *)){
+    LinkedNode head;
+    LinkedNode *tail = &head;
+
+    while(a != NULL && b != NULL){
+        if(compare(a->value, b->value) <= 0){
+            tail->next = a;
+            a = a->next;
+        } else {
+            tail->next = b;
+            b = b->next;
+        }
+        tail = tail->next;
+    }
+
+    tail->next = a != NULL ? a : b;
+
+    return head.next;
+}
+
+// Detach the natural run at the start of *list, reversing it if strictly descending.
+static LinkedNode *linkedListTakeRun(LinkedNode **list, int (*compare)(const void *, const void *)){
+    LinkedNode *run = *list;
+    LinkedNode *last = run;
+
+    if(last->next != NULL && compare(last->value, last->next->value) > 0){
+        LinkedNode *reversed = NULL;
+        LinkedNode *node = run;
+        do {
+            LinkedNode *next = node->next;
+            node->next = reversed;
+            reversed = node;
+            node = next;
+        } while(node != NULL && compare(reversed->value, node->value) > 0);
+
+        *list = node;
+        return reversed;
+    }
+
+    while(last->next != NULL && compare(last->value, last->next->value) <= 0){
+        last = last->next;
+    }
+
+    *list = last->next;
+    last->next = NULL;
+
+    return run;
+}
+
+STD_DDS_RESULT LinkedListSort(LinkedList *list, int (*compare)(const void *a, const void *b)){
+    if(list == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] LinkedListSort failed. LinkedList value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if(compare == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] LinkedListSort failed. Compare function is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if(list->length < 2){
+        return STD_DDS_SUCCESS;
+    }
+
+    LinkedNode *bins[LINKED_LIST_SORT_BINS] = {NULL};
+    size_t binCount = 0;
+    LinkedNode *remaining = list->head;
+
+    while(remaining != NULL){
+        LinkedNode *run = linkedListTakeRun(&remaining, compare);
+
+        // Older bins hold earlier nodes, so they go first to keep the sort stable.
+        size_t i = 0;
+        while(i < binCount && bins[i] != NULL){
+            run = linkedListMerge(bins[i], run, compare);
+            bins[i] = NULL;
+            i++;
+        }
+
+        bins[i] = run;
+        if(i == binCount){
+            binCount++;
+        }
+    }
+
+    LinkedNode *sorted = NULL;
+    for(size_t i = 0; i < binCount; i++){
+        if(bins[i] != NULL){
+            sorted = sorted == NULL ? bins[i] : linkedListMerge(bins[i], sorted, compare);
+        }
+    }
+
+    // Restore the tail and, for back-linked lists, every back link.
+    LinkedNode *prev = NULL;
+    for(LinkedNode *node = sorted; node != NULL; node = node->next){
+        if(list->backLinked){
+            LINKED_BACK_NODE(node)->prev = prev;
+        }
+        prev = node;
+    }
+
+    list->head = sorted;
+    list->tail = prev;
+
+    return STD_DDS_SUCCESS;
 }
 
 size_t LinkedListGetLength(const LinkedList *list){
@@ -235,12 +476,18 @@ STD_DDS_RESULT LinkedListFree(LinkedList *list){
         return STD_DDS_NULL_PARAM;
     }
 
-    LinkedNode *node = list->head;
-    while(node != NULL){
-        LinkedNode *next = node->next;
-        free(node);
-        node = next;
+    if(list->pool != NULL){
+        NodePoolFree(list->pool);
+    } else {
+        LinkedNode *node = list->head;
+        while(node != NULL){
+            LinkedNode *next = node->next;
+            free(node);
+            node = next;
+        }
     }
 
+    free(list);
+
     return STD_DDS_SUCCESS;
 }
@@ -0,0 +1,288 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mpmc_queue.h"
+#include "std_dds_core.h"
+
+#if defined(STD_DDS_WARNING_MSG) && !defined(STD_DDS_ERROR_MSG)
+    #define STD_DDS_ERROR_MSG
+#endif
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#if defined(STD_DDS_ERROR_MSG) || defined(STD_DDS_WARNING_MSG)
+    #include <stdio.h>
+#endif
+
+/* A cell is free for the producer claiming position p when its sequence is p,
+   and holds a value for the consumer claiming position p when it is p + 1. */
+typedef struct mpmcQueueCell {
+    atomic_size_t sequence;
+    void *value;
+} MPMCQueueCell;
+
+struct mpmcQueue {
+    _Alignas(64) atomic_size_t enqueuePos;
+    _Alignas(64) atomic_size_t dequeuePos;
+    _Alignas(64) size_t mask;
+    MPMCQueueCell *cells;
+    atomic_uint waitingProducers;
+    atomic_uint waitingConsumers;
+    pthread_mutex_t lock;
+    pthread_cond_t notFull;
+    pthread_cond_t notEmpty;
+};
+
+// Wake a thread sleeping in a blocking call once the queue has changed. The
+// fence pairs with the one in mpmcQueueAddWaiter() so that either the sleeper sees
+// the change on its last try, or this sees the sleeper and signals it.
+static void mpmcQueueWake(MPMCQueue *queue, atomic_uint *waiting, pthread_cond_t *cond){
+    atomic_thread_fence(memory_order_seq_cst);
+    if(atomic_load_explicit(waiting, memory_order_relaxed) == 0){
+        return;
+    }
+
+    pthread_mutex_lock(&queue->lock);
+    pthread_cond_signal(cond);
+    pthread_mutex_unlock(&queue->lock);
+}
+
+static void mpmcQueueAddWaiter(MPMCQueue *queue, atomic_uint *waiting){
+    atomic_fetch_add_explicit(waiting, 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+}
+
+static STD_DDS_RESULT mpmcQueueTryEnqueue(MPMCQueue *queue, void *value){
+    size_t pos = atomic_load_explicit(&queue->enqueuePos, memory_order_relaxed);
+
+    for(;;){
+        MPMCQueueCell *cell = &queue->cells[pos & queue->mask];
+        size_t sequence = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+        intptr_t diff = (intptr_t)sequence - (intptr_t)pos;
+
+        if(diff == 0){
+            if(atomic_compare_exchange_weak_explicit(&queue->enqueuePos, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed)){
+                cell->value = value;
+                atomic_store_explicit(&cell->sequence, pos + 1, memory_order_release);
+                return STD_DDS_SUCCESS;
+            }
+        } else if(diff < 0){
+            return STD_DDS_FULL;
+        } else {
+            pos = atomic_load_explicit(&queue->enqueuePos, memory_order_relaxed);
+        }
+    }
+}
+
+static int mpmcQueueTryDequeue(MPMCQueue *queue, void **value){
+    size_t pos = atomic_load_explicit(&queue->dequeuePos, memory_order_relaxed);
+
+    for(;;){
+        MPMCQueueCell *cell = &queue->cells[pos & queue->mask];
+        size_t sequence = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+        intptr_t diff = (intptr_t)sequence - (intptr_t)(pos + 1);
+
+        if(diff == 0){
+            if(atomic_compare_exchange_weak_explicit(&queue->dequeuePos, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed)){
+                *value = cell->value;
+                atomic_store_explicit(&cell->sequence, pos + queue->mask + 1, memory_order_release);
+                return 1;
+            }
+        } else if(diff < 0){
+            return 0;
+        } else {
+            pos = atomic_load_explicit(&queue->dequeuePos, memory_order_relaxed);
+        }
+    }
+}
+
+MPMCQueue *MPMCQueueInit(const size_t capacity){
+    if(capacity == 0 || capacity > (SIZE_MAX / sizeof(MPMCQueueCell)) / 2 + 1){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] MPMCQueueInit failed. A capacity of '%zu' elements is invalid.\n", capacity);
+        #endif
+        return NULL;
+    }
+
+    size_t rounded = 2;
+    while(rounded < capacity){
+        rounded *= 2;
+    }
+
+    MPMCQueue *queue = (MPMCQueue *)aligned_alloc(_Alignof(MPMCQueue), sizeof(MPMCQueue));
+    if(queue == NULL){
+        #ifdef STD_DDS_ERROR_MSG
+            fprintf(stderr, "[Error] MPMCQueue aligned_alloc failed. Unable to allocate memory of %zu bytes.\n", sizeof(MPMCQueue));
+        #endif
+        return NULL;
+    }
+
+    queue->cells = (MPMCQueueCell *)malloc(sizeof(MPMCQueueCell) * rounded);
+    if(queue->cells == NULL){
+        #ifdef STD_DDS_ERROR_MSG
+            fprintf(stderr, "[Error] MPMCQueue cells malloc failed. Unable to allocate memory of %zu bytes.\n", sizeof(MPMCQueueCell) * rounded);
+        #endif
+        free(queue);
+        return NULL;
+    }
+
+    for(size_t i = 0; i < rounded; i++){
+        atomic_init(&queue->cells[i].sequence, i);
+        queue->cells[i].value = NULL;
+    }
+
+    atomic_init(&queue->enqueuePos, 0);
+    atomic_init(&queue->dequeuePos, 0);
+    atomic_init(&queue->waitingProducers, 0);
+    atomic_init(&queue->waitingConsumers, 0);
+    queue->mask = rounded - 1;
+
+    pthread_mutex_init(&queue->lock, NULL);
+    pthread_cond_init(&queue->notFull, NULL);
+    pthread_cond_init(&queue->notEmpty, NULL);
+
+    return queue;
+}
+
+STD_DDS_RESULT MPMCQueueTryEnqueue(MPMCQueue *queue, void *value){
+    if(queue == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] MPMCQueueTryEnqueue failed. MPMCQueue value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    STD_DDS_RESULT result = mpmcQueueTryEnqueue(queue, value);
+    if(result == STD_DDS_SUCCESS){
+        mpmcQueueWake(queue, &queue->waitingConsumers, &queue->notEmpty);
+    }
+
+    return result;
+}
+
+void *MPMCQueueTryDequeue(MPMCQueue *queue){
+    if(queue == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] MPMCQueueTryDequeue failed. MPMCQueue value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    void *value;
+    if(!mpmcQueueTryDequeue(queue, &value)){
+        return NULL;
+    }
+
+    mpmcQueueWake(queue, &queue->waitingProducers, &queue->notFull);
+
+    return value;
+}
+
+STD_DDS_RESULT MPMCQueueEnqueue(MPMCQueue *queue, void *value){
+    if(queue == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] MPMCQueueEnqueue failed. MPMCQueue value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if(mpmcQueueTryEnqueue(queue, value) != STD_DDS_SUCCESS){
+        pthread_mutex_lock(&queue->lock);
+        mpmcQueueAddWaiter(queue, &queue->waitingProducers);
+        while(mpmcQueueTryEnqueue(queue, value) != STD_DDS_SUCCESS){
+            pthread_cond_wait(&queue->notFull, &queue->lock);
+        }
+        atomic_fetch_sub_explicit(&queue->waitingProducers, 1, memory_order_relaxed);
+        pthread_mutex_unlock(&queue->lock);
+    }
+
+    mpmcQueueWake(queue, &queue->waitingConsumers, &queue->notEmpty);
+
+    return STD_DDS_SUCCESS;
+}
+
+void *MPMCQueueDequeue(MPMCQueue *queue){
+    if(queue == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] MPMCQueueDequeue failed. MPMCQueue value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    void *value;
+    if(!mpmcQueueTryDequeue(queue, &value)){
+        pthread_mutex_lock(&queue->lock);
+        mpmcQueueAddWaiter(queue, &queue->waitingConsumers);
+        while(!mpmcQueueTryDequeue(queue, &value)){
+            pthread_cond_wait(&queue->notEmpty, &queue->lock);
+        }
+        atomic_fetch_sub_explicit(&queue->waitingConsumers, 1, memory_order_relaxed);
+        pthread_mutex_unlock(&queue->lock);
+    }
+
+    mpmcQueueWake(queue, &queue->waitingProducers, &queue->notFull);
+
+    return value;
+}
+
+size_t MPMCQueueGetLength(const MPMCQueue *queue){
+    if(queue == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] MPMCQueueGetLength failed. MPMCQueue value is NULL.\n");
+        #endif
+        return -1;
+    }
+
+    size_t dequeuePos = atomic_load_explicit(&queue->dequeuePos, memory_order_acquire);
+    size_t enqueuePos = atomic_load_explicit(&queue->enqueuePos, memory_order_acquire);
+
+    // dequeuePos is read first so the difference never wraps below zero, but a
+    // stale dequeuePos can make it exceed the capacity.
+    size_t length = enqueuePos - dequeuePos;
+    return length > queue->mask + 1 ? queue->mask + 1 : length;
+}
+
+size_t MPMCQueueGetCapacity(const MPMCQueue *queue){
+    if(queue == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] MPMCQueueGetCapacity failed. MPMCQueue value is NULL.\n");
+        #endif
+        return -1;
+    }
+
+    return queue->mask + 1;
+}
+
+STD_DDS_RESULT MPMCQueueFree(MPMCQueue *queue){
+    if(queue == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] MPMCQueueFree failed. MPMCQueue value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    pthread_cond_destroy(&queue->notEmpty);
+    pthread_cond_destroy(&queue->notFull);
+    pthread_mutex_destroy(&queue->lock);
+
+    free(queue->cells);
+    free(queue);
+
+    return STD_DDS_SUCCESS;
+}
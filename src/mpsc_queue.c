@@ -0,0 +1,153 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mpsc_queue.h"
+#include "std_dds_core.h"
+
+#if defined(STD_DDS_WARNING_MSG) && !defined(STD_DDS_ERROR_MSG)
+    #define STD_DDS_ERROR_MSG
+#endif
+
+#include <stdlib.h>
+#include <stdatomic.h>
+#if defined(STD_DDS_ERROR_MSG) || defined(STD_DDS_WARNING_MSG)
+    #include <stdio.h>
+#endif
+
+/* Producers swap themselves into head, the consumer walks from tail. The stub
+   hook keeps the list non-empty so neither side ever has to touch the other's
+   end, and head and tail sit on separate cache lines. */
+struct mpscQueue {
+    _Alignas(64) _Atomic(MPSCHook *) head;
+    _Alignas(64) MPSCHook *tail;
+    MPSCHook stub;
+};
+
+static void mpscQueueLink(MPSCQueue *queue, MPSCHook *hook){
+    atomic_store_explicit(&hook->next, NULL, memory_order_relaxed);
+    MPSCHook *prev = atomic_exchange_explicit(&queue->head, hook, memory_order_acq_rel);
+    atomic_store_explicit(&prev->next, hook, memory_order_release);
+}
+
+MPSCQueue *MPSCQueueInit(void){
+    MPSCQueue *queue = (MPSCQueue *)aligned_alloc(_Alignof(MPSCQueue), sizeof(MPSCQueue));
+    if(queue == NULL){
+        #ifdef STD_DDS_ERROR_MSG
+            fprintf(stderr, "[Error] MPSCQueue aligned_alloc failed. Unable to allocate memory of %zu bytes.\n", sizeof(MPSCQueue));
+        #endif
+        return NULL;
+    }
+
+    atomic_init(&queue->stub.next, NULL);
+    atomic_init(&queue->head, &queue->stub);
+    queue->tail = &queue->stub;
+
+    return queue;
+}
+
+STD_DDS_RESULT MPSCQueueEnqueue(MPSCQueue *queue, MPSCHook *hook){
+    if(queue == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] MPSCQueueEnqueue failed. MPSCQueue value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if(hook == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] MPSCQueueEnqueue failed. MPSCHook value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    mpscQueueLink(queue, hook);
+
+    return STD_DDS_SUCCESS;
+}
+
+MPSCHook *MPSCQueueDequeue(MPSCQueue *queue){
+    if(queue == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] MPSCQueueDequeue failed. MPSCQueue value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    MPSCHook *tail = queue->tail;
+    MPSCHook *next = atomic_load_explicit(&tail->next, memory_order_acquire);
+
+    if(tail == &queue->stub){
+        if(next == NULL){
+            return NULL;
+        }
+
+        queue->tail = next;
+        tail = next;
+        next = atomic_load_explicit(&next->next, memory_order_acquire);
+    }
+
+    if(next != NULL){
+        queue->tail = next;
+        return tail;
+    }
+
+    // tail is the last linked hook. If a producer has already swapped itself
+    // into head but not yet linked it, wait for the next call.
+    if(tail != atomic_load_explicit(&queue->head, memory_order_acquire)){
+        return NULL;
+    }
+
+    // Re-link the stub behind tail so tail can be handed out without
+    // leaving the queue without a hook.
+    mpscQueueLink(queue, &queue->stub);
+
+    next = atomic_load_explicit(&tail->next, memory_order_acquire);
+    if(next != NULL){
+        queue->tail = next;
+        return tail;
+    }
+
+    return NULL;
+}
+
+int MPSCQueueIsEmpty(const MPSCQueue *queue){
+    if(queue == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] MPSCQueueIsEmpty failed. MPSCQueue value is NULL.\n");
+        #endif
+        return -1;
+    }
+
+    MPSCHook *tail = queue->tail;
+
+    return tail == &queue->stub
+        && atomic_load_explicit(&tail->next, memory_order_acquire) == NULL
+        && atomic_load_explicit(&queue->head, memory_order_acquire) == tail;
+}
+
+STD_DDS_RESULT MPSCQueueFree(MPSCQueue *queue){
+    if(queue == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] MPSCQueueFree failed. MPSCQueue value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    free(queue);
+
+    return STD_DDS_SUCCESS;
+}
@@ -0,0 +1,268 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "node_pool.h"
+#include "std_dds_core.h"
+
+#if defined(STD_DDS_WARNING_MSG) && !defined(STD_DDS_ERROR_MSG)
+    #define STD_DDS_ERROR_MSG
+#endif
+
+#include <stdlib.h>
+#include <stddef.h>
+#if defined(STD_DDS_ERROR_MSG) || defined(STD_DDS_WARNING_MSG)
+    #include <stdio.h>
+#endif
+
+typedef struct nodePoolSlab {
+    struct nodePoolSlab *next;
+    _Alignas(max_align_t) unsigned char nodes[];
+} NodePoolSlab;
+
+/* Released nodes are threaded through their own first bytes. */
+typedef struct nodePoolFreeNode {
+    struct nodePoolFreeNode *next;
+} NodePoolFreeNode;
+
+struct nodePool {
+    size_t nodeSize;
+    size_t slabLength;
+    NodePoolSlab *slabs;
+    size_t slabUsed;
+    NodePoolFreeNode *freeList;
+    size_t length;
+    size_t refCount;
+};
+
+NodePool *NodePoolInit(const size_t nodeSize, const size_t slabLength){
+    if(nodeSize == 0){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] NodePoolInit failed. Node size must be greater than 0.\n");
+        #endif
+        return NULL;
+    }
+
+    NodePool *pool = (NodePool *)malloc(sizeof(NodePool));
+    if(pool == NULL){
+        #ifdef STD_DDS_ERROR_MSG
+            fprintf(stderr, "[Error] NodePool malloc failed. Unable to allocate memory of %zu bytes.\n", sizeof(NodePool));
+        #endif
+        return NULL;
+    }
+
+    // Round up so every node in a slab stays pointer aligned.
+    size_t align = _Alignof(void *);
+    size_t size = nodeSize < sizeof(NodePoolFreeNode) ? sizeof(NodePoolFreeNode) : nodeSize;
+
+    pool->nodeSize = (size + align - 1) / align * align;
+    pool->slabLength = slabLength == 0 ? STD_DDS_NODE_POOL_SLAB_LENGTH : slabLength;
+    pool->slabs = NULL;
+    pool->slabUsed = pool->slabLength;
+    pool->freeList = NULL;
+    pool->length = 0;
+    pool->refCount = 1;
+
+    return pool;
+}
+
+void *NodePoolAlloc(NodePool *pool){
+    if(pool == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] NodePoolAlloc failed. NodePool value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    if(pool->freeList != NULL){
+        NodePoolFreeNode *node = pool->freeList;
+        pool->freeList = node->next;
+        pool->length++;
+        return node;
+    }
+
+    if(pool->slabUsed == pool->slabLength){
+        size_t bytes = sizeof(NodePoolSlab) + pool->nodeSize * pool->slabLength;
+        NodePoolSlab *slab = (NodePoolSlab *)malloc(bytes);
+        if(slab == NULL){
+            #ifdef STD_DDS_ERROR_MSG
+                fprintf(stderr, "[Error] NodePool slab malloc failed. Unable to allocate memory of %zu bytes.\n", bytes);
+            #endif
+            return NULL;
+        }
+
+        slab->next = pool->slabs;
+        pool->slabs = slab;
+        pool->slabUsed = 0;
+    }
+
+    void *node = pool->slabs->nodes + pool->nodeSize * pool->slabUsed;
+    pool->slabUsed++;
+    pool->length++;
+
+    return node;
+}
+
+STD_DDS_RESULT NodePoolRelease(NodePool *pool, void *node){
+    if(pool == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] NodePoolRelease failed. NodePool value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if(node == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] NodePoolRelease failed. Node value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    NodePoolFreeNode *freeNode = (NodePoolFreeNode *)node;
+    freeNode->next = pool->freeList;
+    pool->freeList = freeNode;
+    pool->length--;
+
+    return STD_DDS_SUCCESS;
+}
+
+STD_DDS_RESULT NodePoolRetain(NodePool *pool){
+    if(pool == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] NodePoolRetain failed. NodePool value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    pool->refCount++;
+
+    return STD_DDS_SUCCESS;
+}
+
+STD_DDS_RESULT NodePoolMerge(NodePool *dst, NodePool *src){
+    if(dst == NULL || src == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] NodePoolMerge failed. NodePool value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if(dst == src || dst->nodeSize != src->nodeSize || src->refCount > 1){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] NodePoolMerge failed. Pools must be distinct, share a node size and src must not be shared.\n");
+        #endif
+        return STD_DDS_INVALID_PARAM;
+    }
+
+    if(src->slabs != NULL){
+        // Hand the unused tail of src's current slab to dst's freelist.
+        for(size_t i = src->slabUsed; i < src->slabLength; i++){
+            NodePoolFreeNode *node = (NodePoolFreeNode *)(src->slabs->nodes + src->nodeSize * i);
+            node->next = src->freeList;
+            src->freeList = node;
+        }
+
+        NodePoolSlab *last = src->slabs;
+        while(last->next != NULL){
+            last = last->next;
+        }
+
+        // Keep dst's current slab at the head so its bump allocation continues.
+        if(dst->slabs != NULL){
+            last->next = dst->slabs->next;
+            dst->slabs->next = src->slabs;
+        } else {
+            last->next = NULL;
+            dst->slabs = src->slabs;
+            dst->slabUsed = dst->slabLength;
+        }
+    }
+
+    if(src->freeList != NULL){
+        NodePoolFreeNode *last = src->freeList;
+        while(last->next != NULL){
+            last = last->next;
+        }
+        last->next = dst->freeList;
+        dst->freeList = src->freeList;
+    }
+
+    dst->length += src->length;
+
+    src->slabs = NULL;
+    src->slabUsed = src->slabLength;
+    src->freeList = NULL;
+    src->length = 0;
+
+    return STD_DDS_SUCCESS;
+}
+
+size_t NodePoolGetNodeSize(const NodePool *pool){
+    if(pool == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] NodePoolGetNodeSize failed. NodePool value is NULL.\n");
+        #endif
+        return -1;
+    }
+
+    return pool->nodeSize;
+}
+
+size_t NodePoolGetLength(const NodePool *pool){
+    if(pool == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] NodePoolGetLength failed. NodePool value is NULL.\n");
+        #endif
+        return -1;
+    }
+
+    return pool->length;
+}
+
+size_t NodePoolGetRefCount(const NodePool *pool){
+    if(pool == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] NodePoolGetRefCount failed. NodePool value is NULL.\n");
+        #endif
+        return -1;
+    }
+
+    return pool->refCount;
+}
+
+STD_DDS_RESULT NodePoolFree(NodePool *pool){
+    if(pool == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] NodePoolFree failed. NodePool value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if(--pool->refCount > 0){
+        return STD_DDS_SUCCESS;
+    }
+
+    NodePoolSlab *slab = pool->slabs;
+    while(slab != NULL){
+        NodePoolSlab *next = slab->next;
+        free(slab);
+        slab = next;
+    }
+
+    free(pool);
+
+    return STD_DDS_SUCCESS;
+}
@@ -0,0 +1,309 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "pairing_heap.h"
+#include "std_dds_core.h"
+#include "node_pool.h"
+
+#if defined(STD_DDS_WARNING_MSG) && !defined(STD_DDS_ERROR_MSG)
+    #define STD_DDS_ERROR_MSG
+#endif
+
+#include <stdlib.h>
+#if defined(STD_DDS_ERROR_MSG) || defined(STD_DDS_WARNING_MSG)
+    #include <stdio.h>
+#endif
+
+struct pairingHeap {
+    PairingHeapNode *root;
+    size_t length;
+    NodePool *pool;
+};
+
+// Link two detached trees, the root with the greater key becomes the leftmost
+// child of the other. Returns the new root.
+static PairingHeapNode *pairingHeapLink(PairingHeapNode *a, PairingHeapNode *b){
+    if(a == NULL){
+        return b;
+    }
+    if(b == NULL){
+        return a;
+    }
+
+    if(b->key < a->key){
+        PairingHeapNode *swap = a;
+        a = b;
+        b = swap;
+    }
+
+    b->prev = a;
+    b->sibling = a->child;
+    if(a->child != NULL){
+        a->child->prev = b;
+    }
+    a->child = b;
+
+    return a;
+}
+
+// Merge a list of sibling trees into one with the two-pass method. The first
+// pass links pairs left to right and pushes each result onto a stack through
+// its sibling pointer, the second pops the stack linking right to left.
+static PairingHeapNode *pairingHeapMergePairs(PairingHeapNode *first){
+    PairingHeapNode *stack = NULL;
+
+    while(first != NULL){
+        PairingHeapNode *a = first;
+        PairingHeapNode *b = a->sibling;
+        first = b != NULL ? b->sibling : NULL;
+
+        a->sibling = NULL;
+        a->prev = NULL;
+        if(b != NULL){
+            b->sibling = NULL;
+            b->prev = NULL;
+        }
+
+        PairingHeapNode *pair = pairingHeapLink(a, b);
+        pair->sibling = stack;
+        stack = pair;
+    }
+
+    PairingHeapNode *root = NULL;
+    while(stack != NULL){
+        PairingHeapNode *next = stack->sibling;
+        stack->sibling = NULL;
+        root = pairingHeapLink(stack, root);
+        stack = next;
+    }
+
+    return root;
+}
+
+// Unlink a non-root node and its subtree from its parent or left sibling.
+static void pairingHeapCut(PairingHeapNode *node){
+    if(node->prev->child == node){
+        node->prev->child = node->sibling;
+    } else {
+        node->prev->sibling = node->sibling;
+    }
+
+    if(node->sibling != NULL){
+        node->sibling->prev = node->prev;
+    }
+
+    node->sibling = NULL;
+    node->prev = NULL;
+}
+
+PairingHeap *PairingHeapInit(void){
+    PairingHeap *heap = (PairingHeap *)malloc(sizeof(PairingHeap));
+    if(heap == NULL){
+        #ifdef STD_DDS_ERROR_MSG
+            fprintf(stderr, "[Error] PairingHeap malloc failed. Unable to allocate memory of %zu bytes.\n", sizeof(PairingHeap));
+        #endif
+        return NULL;
+    }
+
+    heap->pool = NodePoolInit(sizeof(PairingHeapNode), 0);
+    if(heap->pool == NULL){
+        free(heap);
+        return NULL;
+    }
+
+    heap->root = NULL;
+    heap->length = 0;
+
+    return heap;
+}
+
+PairingHeapNode *PairingHeapInsert(PairingHeap *heap, const long long key, void *value){
+    if(heap == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] PairingHeapInsert failed. PairingHeap value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    PairingHeapNode *node = (PairingHeapNode *)NodePoolAlloc(heap->pool);
+    if(node == NULL){
+        return NULL;
+    }
+
+    node->key = key;
+    node->value = value;
+    node->child = NULL;
+    node->sibling = NULL;
+    node->prev = NULL;
+
+    heap->root = pairingHeapLink(heap->root, node);
+    heap->length++;
+
+    return node;
+}
+
+PairingHeapNode *PairingHeapPeek(const PairingHeap *heap){
+    if(heap == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] PairingHeapPeek failed. PairingHeap value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    return heap->root;
+}
+
+void *PairingHeapPop(PairingHeap *heap, long long *key){
+    if(heap == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] PairingHeapPop failed. PairingHeap value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    PairingHeapNode *root = heap->root;
+    if(root == NULL){
+        return NULL;
+    }
+
+    heap->root = pairingHeapMergePairs(root->child);
+    heap->length--;
+
+    if(key != NULL){
+        *key = root->key;
+    }
+
+    void *value = root->value;
+    NodePoolRelease(heap->pool, root);
+
+    return value;
+}
+
+STD_DDS_RESULT PairingHeapDecreaseKey(PairingHeap *heap, PairingHeapNode *node, const long long key){
+    if(heap == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] PairingHeapDecreaseKey failed. PairingHeap value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if(node == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] PairingHeapDecreaseKey failed. PairingHeapNode value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if(key > node->key){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] PairingHeapDecreaseKey failed. Key '%lld' is greater than the current key '%lld'.\n", key, node->key);
+        #endif
+        return STD_DDS_INVALID_PARAM;
+    }
+
+    node->key = key;
+
+    if(node != heap->root){
+        pairingHeapCut(node);
+        heap->root = pairingHeapLink(heap->root, node);
+    }
+
+    return STD_DDS_SUCCESS;
+}
+
+void *PairingHeapRemove(PairingHeap *heap, PairingHeapNode *node){
+    if(heap == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] PairingHeapRemove failed. PairingHeap value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    if(node == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] PairingHeapRemove failed. PairingHeapNode value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    if(node == heap->root){
+        return PairingHeapPop(heap, NULL);
+    }
+
+    pairingHeapCut(node);
+    heap->root = pairingHeapLink(heap->root, pairingHeapMergePairs(node->child));
+    heap->length--;
+
+    void *value = node->value;
+    NodePoolRelease(heap->pool, node);
+
+    return value;
+}
+
+STD_DDS_RESULT PairingHeapMeld(PairingHeap *dst, PairingHeap *src){
+    if(dst == NULL || src == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] PairingHeapMeld failed. PairingHeap value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if(dst == src){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] PairingHeapMeld failed. PairingHeaps must be distinct.\n");
+        #endif
+        return STD_DDS_INVALID_PARAM;
+    }
+
+    STD_DDS_RESULT result = NodePoolMerge(dst->pool, src->pool);
+    if(result != STD_DDS_SUCCESS){
+        return result;
+    }
+
+    dst->root = pairingHeapLink(dst->root, src->root);
+    dst->length += src->length;
+
+    src->root = NULL;
+    src->length = 0;
+
+    return STD_DDS_SUCCESS;
+}
+
+size_t PairingHeapGetLength(const PairingHeap *heap){
+    if(heap == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] PairingHeapGetLength failed. PairingHeap value is NULL.\n");
+        #endif
+        return -1;
+    }
+
+    return heap->length;
+}
+
+STD_DDS_RESULT PairingHeapFree(PairingHeap *heap){
+    if(heap == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] PairingHeapFree failed. PairingHeap value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    NodePoolFree(heap->pool);
+    free(heap);
+
+    return STD_DDS_SUCCESS;
+}
@@ -0,0 +1,354 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "priority_queue.h"
+#include "std_dds_core.h"
+#include "std_dds_inline.h"
+
+#if defined(STD_DDS_WARNING_MSG) && !defined(STD_DDS_ERROR_MSG)
+    #define STD_DDS_ERROR_MSG
+#endif
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#if defined(STD_DDS_ERROR_MSG) || defined(STD_DDS_WARNING_MSG)
+    #include <stdio.h>
+#endif
+
+// Whether entry a should be popped before entry b.
+static inline int priorityQueueBefore(const PriorityQueue *queue, const PriorityQueueEntry *a, const PriorityQueueEntry *b) {
+    if (queue->compare != NULL) {
+        return queue->compare(a->value, b->value) < 0;
+    }
+
+    return a->key < b->key;
+}
+
+/**
+ * Grow the entries of a PriorityQueue to fit at least minCapacity elements,
+ * doubling its capacity.
+**/
+static STD_DDS_RESULT priorityQueueGrow(PriorityQueue *queue, size_t minCapacity) {
+    if (minCapacity > SIZE_MAX / sizeof(PriorityQueueEntry)) {
+        #ifdef STD_DDS_ERROR_MSG
+            fprintf(stderr, "[Error] PriorityQueue capacity of '%zu' elements cannot grow further.\n", queue->capacity);
+        #endif
+        return STD_DDS_REALLOC_FAILED;
+    }
+
+    size_t capacity = queue->capacity < 4 ? 4 : queue->capacity;
+    while (capacity < minCapacity) {
+        capacity = capacity > SIZE_MAX / sizeof(PriorityQueueEntry) / 2 ? minCapacity : capacity * 2;
+    }
+
+    PriorityQueueEntry *entries = realloc(queue->entries, sizeof(PriorityQueueEntry) * capacity);
+    if (entries == NULL) {
+        #ifdef STD_DDS_ERROR_MSG
+            fprintf(stderr, "[Error] PriorityQueue entries realloc failed. Unable to reallocate memory of %zu bytes.\n", sizeof(PriorityQueueEntry) * capacity);
+        #endif
+        return STD_DDS_REALLOC_FAILED;
+    }
+
+    queue->entries = entries;
+    queue->capacity = capacity;
+
+    return STD_DDS_SUCCESS;
+}
+
+// Move the entry at index up towards the root until its parent comes before it,
+// shifting parents down into the hole instead of swapping.
+static void priorityQueueSiftUp(PriorityQueue *queue, size_t index) {
+    PriorityQueueEntry entry = queue->entries[index];
+
+    while (index > 0) {
+        size_t parent = (index - 1) / queue->arity;
+        if (!priorityQueueBefore(queue, &entry, &queue->entries[parent])) {
+            break;
+        }
+
+        queue->entries[index] = queue->entries[parent];
+        index = parent;
+    }
+
+    queue->entries[index] = entry;
+}
+
+// Move the entry at index down until none of its children come before it.
+static void priorityQueueSiftDown(PriorityQueue *queue, size_t index) {
+    PriorityQueueEntry entry = queue->entries[index];
+    size_t length = queue->length;
+    size_t arity = queue->arity;
+
+    for (;;) {
+        size_t first = index * arity + 1;
+        if (first >= length || first < index) {
+            break;
+        }
+
+        size_t last = length - first > arity ? first + arity : length;
+        size_t best = first;
+        for (size_t child = first + 1; child < last; child++) {
+            if (priorityQueueBefore(queue, &queue->entries[child], &queue->entries[best])) {
+                best = child;
+            }
+        }
+
+        if (!priorityQueueBefore(queue, &queue->entries[best], &entry)) {
+            break;
+        }
+
+        queue->entries[index] = queue->entries[best];
+        index = best;
+    }
+
+    queue->entries[index] = entry;
+}
+
+static PriorityQueue *priorityQueueInit(size_t arity, int (*compare)(const void *a, const void *b), size_t capacity) {
+    if (arity == 0) {
+        arity = STD_DDS_PRIORITY_QUEUE_ARITY;
+    }
+
+    if (arity < 2) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] PriorityQueueInit failed. An arity of '%zu' is invalid.\n", arity);
+        #endif
+        return NULL;
+    }
+
+    PriorityQueue *queue = (PriorityQueue *)malloc(sizeof(PriorityQueue));
+    if (queue == NULL) {
+        #ifdef STD_DDS_ERROR_MSG
+            fprintf(stderr, "[Error] PriorityQueue malloc failed. Unable to allocate memory of %zu bytes.\n", sizeof(PriorityQueue));
+        #endif
+        return NULL;
+    }
+
+    queue->entries = NULL;
+    queue->length = 0;
+    queue->capacity = 0;
+    queue->arity = arity;
+    queue->compare = compare;
+
+    if (capacity > 0 && priorityQueueGrow(queue, capacity) != STD_DDS_SUCCESS) {
+        free(queue);
+        return NULL;
+    }
+
+    return queue;
+}
+
+PriorityQueue *PriorityQueueInit(const size_t arity, int (*compare)(const void *a, const void *b)) {
+    return priorityQueueInit(arity, compare, 0);
+}
+
+PriorityQueue *PriorityQueueInitFromArrayList(const ArrayList *list, const size_t arity, int (*compare)(const void *a, const void *b)) {
+    if (list == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] PriorityQueueInitFromArrayList failed. ArrayList value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    if (compare == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] PriorityQueueInitFromArrayList failed. Compare function is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    size_t length = ArrayListGetLengthUnchecked(list);
+
+    PriorityQueue *queue = priorityQueueInit(arity, compare, length);
+    if (queue == NULL) {
+        return NULL;
+    }
+
+    void **values = ArrayListGetValuesUnchecked(list);
+    for (size_t i = 0; i < length; i++) {
+        queue->entries[i].key = 0;
+        queue->entries[i].value = values[i];
+    }
+    queue->length = length;
+
+    // Sift down every node that has children, deepest first.
+    if (length > 1) {
+        for (size_t i = (length - 2) / queue->arity + 1; i > 0; i--) {
+            priorityQueueSiftDown(queue, i - 1);
+        }
+    }
+
+    return queue;
+}
+
+static STD_DDS_RESULT priorityQueuePush(PriorityQueue *queue, long long key, void *value) {
+    if (queue->length == queue->capacity) {
+        STD_DDS_RESULT result = priorityQueueGrow(queue, queue->length + 1);
+        if (result != STD_DDS_SUCCESS) {
+            return result;
+        }
+    }
+
+    queue->entries[queue->length].key = key;
+    queue->entries[queue->length].value = value;
+    queue->length++;
+
+    priorityQueueSiftUp(queue, queue->length - 1);
+
+    return STD_DDS_SUCCESS;
+}
+
+STD_DDS_RESULT PriorityQueuePush(PriorityQueue *queue, void *value) {
+    if (queue == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] PriorityQueuePush failed. PriorityQueue value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if (queue->compare == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] PriorityQueuePush failed. PriorityQueue is keyed, use PriorityQueuePushKeyed().\n");
+        #endif
+        return STD_DDS_INVALID_PARAM;
+    }
+
+    return priorityQueuePush(queue, 0, value);
+}
+
+STD_DDS_RESULT PriorityQueuePushKeyed(PriorityQueue *queue, const long long key, void *value) {
+    if (queue == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] PriorityQueuePushKeyed failed. PriorityQueue value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if (queue->compare != NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] PriorityQueuePushKeyed failed. PriorityQueue is ordered by a comparator, use PriorityQueuePush().\n");
+        #endif
+        return STD_DDS_INVALID_PARAM;
+    }
+
+    return priorityQueuePush(queue, key, value);
+}
+
+void *PriorityQueuePopKeyed(PriorityQueue *queue, long long *key) {
+    if (queue == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] PriorityQueuePopKeyed failed. PriorityQueue value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    if (queue->length < 1) {
+        return NULL;
+    }
+
+    PriorityQueueEntry first = queue->entries[0];
+
+    queue->length--;
+    if (queue->length > 0) {
+        queue->entries[0] = queue->entries[queue->length];
+        priorityQueueSiftDown(queue, 0);
+    }
+
+    if (key != NULL) {
+        *key = first.key;
+    }
+
+    return first.value;
+}
+
+void *PriorityQueuePop(PriorityQueue *queue) {
+    if (queue == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] PriorityQueuePop failed. PriorityQueue value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    return PriorityQueuePopKeyed(queue, NULL);
+}
+
+void *PriorityQueuePeekKeyed(const PriorityQueue *queue, long long *key) {
+    if (queue == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] PriorityQueuePeekKeyed failed. PriorityQueue value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    if (queue->length < 1) {
+        return NULL;
+    }
+
+    if (key != NULL) {
+        *key = queue->entries[0].key;
+    }
+
+    return queue->entries[0].value;
+}
+
+void *PriorityQueuePeek(const PriorityQueue *queue) {
+    if (queue == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] PriorityQueuePeek failed. PriorityQueue value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    return PriorityQueuePeekKeyed(queue, NULL);
+}
+
+size_t PriorityQueueGetLength(const PriorityQueue *queue) {
+    if (queue == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] PriorityQueueGetLength failed. PriorityQueue value is NULL.\n");
+        #endif
+        return -1;
+    }
+
+    return queue->length;
+}
+
+size_t PriorityQueueGetArity(const PriorityQueue *queue) {
+    if (queue == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] PriorityQueueGetArity failed. PriorityQueue value is NULL.\n");
+        #endif
+        return -1;
+    }
+
+    return queue->arity;
+}
+
+STD_DDS_RESULT PriorityQueueFree(PriorityQueue *queue) {
+    if (queue == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] PriorityQueueFree failed. PriorityQueue value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    free(queue->entries);
+    free(queue);
+
+    return STD_DDS_SUCCESS;
+}
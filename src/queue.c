@@ -17,23 +17,57 @@
 
 #include "queue.h"
 #include "std_dds_core.h"
+#include "std_dds_inline.h"
+#include "node_pool.h"
 
 #if defined(STD_DDS_WARNING_MSG) && !defined(STD_DDS_ERROR_MSG)
     #define STD_DDS_ERROR_MSG
 #endif
 
 #include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
 #if defined(STD_DDS_ERROR_MSG) || defined(STD_DDS_WARNING_MSG)
     #include <stdio.h>
 #endif
 
-typedef struct queue {
-    DLinkedNode *head;
-    DLinkedNode *tail;
-    size_t length;
-} Queue;
+/**
+ * Grow the array of a ring-backed Queue to fit at least minCapacity elements,
+ * doubling its capacity so it stays a power of two. The wrapped part of the
+ * elements is moved behind the old end so they stay contiguous from start.
+**/
+static STD_DDS_RESULT queueGrow(Queue *queue, size_t minCapacity) {
+    size_t capacity = queue->capacity < 4 ? 4 : queue->capacity;
+    while (capacity < minCapacity) {
+        if (capacity > SIZE_MAX / sizeof(void *) / 2) {
+            #ifdef STD_DDS_ERROR_MSG
+                fprintf(stderr, "[Error] Queue capacity of '%zu' elements cannot grow further.\n", queue->capacity);
+            #endif
+            return STD_DDS_REALLOC_FAILED;
+        }
+        capacity *= 2;
+    }
 
-Queue *QueueInit() {
+    void **values = realloc(queue->values, sizeof(void *) * capacity);
+    if (values == NULL) {
+        #ifdef STD_DDS_ERROR_MSG
+            fprintf(stderr, "[Error] Queue values realloc failed. Unable to reallocate memory of %zu bytes.\n", sizeof(void *) * capacity);
+        #endif
+        return STD_DDS_REALLOC_FAILED;
+    }
+
+    size_t oldCapacity = queue->capacity;
+    if (queue->start + queue->length > oldCapacity) {
+        memcpy(values + oldCapacity, values, sizeof(void *) * (queue->start + queue->length - oldCapacity));
+    }
+
+    queue->values = values;
+    queue->capacity = capacity;
+
+    return STD_DDS_SUCCESS;
+}
+
+static Queue *queueInit(int pooled, size_t slabLength) {
     Queue *queue = (Queue *)malloc(sizeof(Queue));
     if (queue == NULL) {
         #ifdef STD_DDS_ERROR_MSG
@@ -45,6 +79,43 @@ Queue *QueueInit() {
     queue->head = NULL;
     queue->tail = NULL;
     queue->length = 0;
+    queue->pool = NULL;
+    queue->values = NULL;
+    queue->capacity = 0;
+    queue->start = 0;
+    queue->ringBacked = 0;
+
+    if (pooled) {
+        queue->pool = NodePoolInit(sizeof(DLinkedNode), slabLength);
+        if (queue->pool == NULL) {
+            free(queue);
+            return NULL;
+        }
+    }
+
+    return queue;
+}
+
+Queue *QueueInit() {
+    return queueInit(0, 0);
+}
+
+Queue *QueueInitPooled(const size_t slabLength) {
+    return queueInit(1, slabLength);
+}
+
+Queue *QueueInitRing(const size_t capacity) {
+    Queue *queue = queueInit(0, 0);
+    if (queue == NULL) {
+        return NULL;
+    }
+
+    queue->ringBacked = 1;
+
+    if (capacity > 0 && queueGrow(queue, capacity) != STD_DDS_SUCCESS) {
+        free(queue);
+        return NULL;
+    }
 
     return queue;
 }
@@ -57,7 +128,32 @@ STD_DDS_RESULT QueueEnqueue(Queue *queue, void *value) {
         return STD_DDS_NULL_PARAM;
     }
 
-    DLinkedNode *node = DLinkedNodeInit(value);
+    if (queue->ringBacked) {
+        if (queue->length == queue->capacity) {
+            STD_DDS_RESULT result = queueGrow(queue, queue->length + 1);
+            if (result != STD_DDS_SUCCESS) {
+                return result;
+            }
+        }
+
+        queue->values[(queue->start + queue->length) & (queue->capacity - 1)] = value;
+        queue->length++;
+
+        return STD_DDS_SUCCESS;
+    }
+
+    DLinkedNode *node;
+    if (queue->pool != NULL) {
+        node = (DLinkedNode *)NodePoolAlloc(queue->pool);
+        if (node != NULL) {
+            node->value = value;
+            node->next = NULL;
+            node->prev = NULL;
+        }
+    } else {
+        node = DLinkedNodeInit(value);
+    }
+
     if(node == NULL){
         return STD_DDS_MALLOC_FAILED;
     }
@@ -86,6 +182,18 @@ void *QueueDequeue(Queue *queue) {
         return NULL;
     }
 
+    if (queue->ringBacked) {
+        if (queue->length < 1) {
+            return NULL;
+        }
+
+        void *value = queue->values[queue->start];
+        queue->start = (queue->start + 1) & (queue->capacity - 1);
+        queue->length--;
+
+        return value;
+    }
+
     DLinkedNode *currHead = queue->head;
 
     if (currHead == NULL || queue->length < 1) {
@@ -108,11 +216,127 @@ void *QueueDequeue(Queue *queue) {
 
     void *value = currHead->value;
 
-    free(currHead);
+    if (queue->pool != NULL) {
+        NodePoolRelease(queue->pool, currHead);
+    } else {
+        free(currHead);
+    }
 
     return value;
 }
 
+STD_DDS_RESULT QueueEnqueueN(Queue *queue, void *const *values, const size_t n) {
+    if (queue == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] QueueEnqueueN failed. Queue value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if (values == NULL && n > 0) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] QueueEnqueueN failed. Values array is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if (!queue->ringBacked) {
+        for (size_t i = 0; i < n; i++) {
+            STD_DDS_RESULT result = QueueEnqueue(queue, values[i]);
+            if (result != STD_DDS_SUCCESS) {
+                return result;
+            }
+        }
+
+        return STD_DDS_SUCCESS;
+    }
+
+    if (n > SIZE_MAX - queue->length) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] QueueEnqueueN failed. Enqueuing '%zu' elements would overflow the Queue's length.\n", n);
+        #endif
+        return STD_DDS_INVALID_PARAM;
+    }
+
+    if (n == 0) {
+        return STD_DDS_SUCCESS;
+    }
+
+    if (queue->length + n > queue->capacity) {
+        STD_DDS_RESULT result = queueGrow(queue, queue->length + n);
+        if (result != STD_DDS_SUCCESS) {
+            return result;
+        }
+    }
+
+    size_t tail = (queue->start + queue->length) & (queue->capacity - 1);
+    size_t first = queue->capacity - tail < n ? queue->capacity - tail : n;
+
+    memcpy(queue->values + tail, values, sizeof(void *) * first);
+    if (first < n) {
+        memcpy(queue->values, values + first, sizeof(void *) * (n - first));
+    }
+
+    queue->length += n;
+
+    return STD_DDS_SUCCESS;
+}
+
+size_t QueueDequeueN(Queue *queue, void **values, const size_t n) {
+    if (queue == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] QueueDequeueN failed. Queue value is NULL.\n");
+        #endif
+        return -1;
+    }
+
+    size_t count = n < queue->length ? n : queue->length;
+
+    if (!queue->ringBacked) {
+        for (size_t i = 0; i < count; i++) {
+            void *value = QueueDequeue(queue);
+            if (values != NULL) {
+                values[i] = value;
+            }
+        }
+
+        return count;
+    }
+
+    if (count == 0) {
+        return 0;
+    }
+
+    size_t first = queue->capacity - queue->start < count ? queue->capacity - queue->start : count;
+
+    if (values != NULL) {
+        memcpy(values, queue->values + queue->start, sizeof(void *) * first);
+        if (first < count) {
+            memcpy(values + first, queue->values, sizeof(void *) * (count - first));
+        }
+    }
+
+    queue->start = (queue->start + count) & (queue->capacity - 1);
+    queue->length -= count;
+
+    return count;
+}
+
+void *QueuePeek(const Queue *queue) {
+    if (queue == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] QueuePeek failed. Queue value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    if (queue->length < 1) {
+        return NULL;
+    }
+
+    return queue->ringBacked ? queue->values[queue->start] : queue->head->value;
+}
+
 size_t QueueGetLength(const Queue *queue) {
     if (queue == NULL) {
         #ifdef STD_DDS_WARNING_MSG
@@ -154,11 +378,17 @@ STD_DDS_RESULT QueueFree(Queue *queue) {
         return STD_DDS_NULL_PARAM;
     }
 
-    DLinkedNode *node = queue->head;
-    while (node != NULL) {
-        DLinkedNode *next = node->next;
-        free(node);
-        node = next;
+    if (queue->ringBacked) {
+        free(queue->values);
+    } else if (queue->pool != NULL) {
+        NodePoolFree(queue->pool);
+    } else {
+        DLinkedNode *node = queue->head;
+        while (node != NULL) {
+            DLinkedNode *prev = node->prev;
+            free(node);
+            node = prev;
+        }
     }
 
     free(queue);
@@ -0,0 +1,227 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "radix_heap.h"
+#include "std_dds_core.h"
+#include "node_pool.h"
+
+#if defined(STD_DDS_WARNING_MSG) && !defined(STD_DDS_ERROR_MSG)
+    #define STD_DDS_ERROR_MSG
+#endif
+
+#include <stdlib.h>
+#if defined(STD_DDS_ERROR_MSG) || defined(STD_DDS_WARNING_MSG)
+    #include <stdio.h>
+#endif
+
+#define RADIX_HEAP_BUCKETS 65
+
+typedef struct radixHeapNode {
+    unsigned long long key;
+    void *value;
+    struct radixHeapNode *next;
+} RadixHeapNode;
+
+/* Bucket 0 holds keys equal to last, bucket i holds keys whose highest bit
+   differing from last is bit i - 1. */
+struct radixHeap {
+    RadixHeapNode *buckets[RADIX_HEAP_BUCKETS];
+    size_t length;
+    unsigned long long last;
+    NodePool *pool;
+};
+
+static inline size_t radixHeapBucket(const RadixHeap *heap, unsigned long long key){
+    unsigned long long diff = key ^ heap->last;
+    if(diff == 0){
+        return 0;
+    }
+
+    #if defined(__GNUC__)
+        return 64 - __builtin_clzll(diff);
+    #else
+        size_t bits = 0;
+        while(diff != 0){
+            diff >>= 1;
+            bits++;
+        }
+        return bits;
+    #endif
+}
+
+// Make sure bucket 0 is non-empty by moving last up to the lowest key of the
+// first non-empty bucket and redistributing that bucket. Each of its nodes
+// lands in a lower bucket, since it now shares more high bits with last.
+static void radixHeapPull(RadixHeap *heap){
+    if(heap->buckets[0] != NULL){
+        return;
+    }
+
+    size_t i = 1;
+    while(heap->buckets[i] == NULL){
+        i++;
+    }
+
+    RadixHeapNode *node = heap->buckets[i];
+    unsigned long long min = node->key;
+    for(RadixHeapNode *curr = node->next; curr != NULL; curr = curr->next){
+        if(curr->key < min){
+            min = curr->key;
+        }
+    }
+
+    heap->last = min;
+    heap->buckets[i] = NULL;
+
+    while(node != NULL){
+        RadixHeapNode *next = node->next;
+        size_t bucket = radixHeapBucket(heap, node->key);
+        node->next = heap->buckets[bucket];
+        heap->buckets[bucket] = node;
+        node = next;
+    }
+}
+
+RadixHeap *RadixHeapInit(void){
+    RadixHeap *heap = (RadixHeap *)malloc(sizeof(RadixHeap));
+    if(heap == NULL){
+        #ifdef STD_DDS_ERROR_MSG
+            fprintf(stderr, "[Error] RadixHeap malloc failed. Unable to allocate memory of %zu bytes.\n", sizeof(RadixHeap));
+        #endif
+        return NULL;
+    }
+
+    heap->pool = NodePoolInit(sizeof(RadixHeapNode), 0);
+    if(heap->pool == NULL){
+        free(heap);
+        return NULL;
+    }
+
+    for(size_t i = 0; i < RADIX_HEAP_BUCKETS; i++){
+        heap->buckets[i] = NULL;
+    }
+    heap->length = 0;
+    heap->last = 0;
+
+    return heap;
+}
+
+STD_DDS_RESULT RadixHeapPush(RadixHeap *heap, const unsigned long long key, void *value){
+    if(heap == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] RadixHeapPush failed. RadixHeap value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if(key < heap->last){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] RadixHeapPush failed. Key '%llu' is lower than the last key popped '%llu'.\n", key, heap->last);
+        #endif
+        return STD_DDS_INVALID_PARAM;
+    }
+
+    RadixHeapNode *node = (RadixHeapNode *)NodePoolAlloc(heap->pool);
+    if(node == NULL){
+        return STD_DDS_MALLOC_FAILED;
+    }
+
+    size_t bucket = radixHeapBucket(heap, key);
+
+    node->key = key;
+    node->value = value;
+    node->next = heap->buckets[bucket];
+    heap->buckets[bucket] = node;
+
+    heap->length++;
+
+    return STD_DDS_SUCCESS;
+}
+
+void *RadixHeapPop(RadixHeap *heap, unsigned long long *key){
+    if(heap == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] RadixHeapPop failed. RadixHeap value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    if(heap->length < 1){
+        return NULL;
+    }
+
+    radixHeapPull(heap);
+
+    RadixHeapNode *node = heap->buckets[0];
+    heap->buckets[0] = node->next;
+    heap->length--;
+
+    if(key != NULL){
+        *key = node->key;
+    }
+
+    void *value = node->value;
+    NodePoolRelease(heap->pool, node);
+
+    return value;
+}
+
+void *RadixHeapPeek(RadixHeap *heap, unsigned long long *key){
+    if(heap == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] RadixHeapPeek failed. RadixHeap value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    if(heap->length < 1){
+        return NULL;
+    }
+
+    radixHeapPull(heap);
+
+    if(key != NULL){
+        *key = heap->buckets[0]->key;
+    }
+
+    return heap->buckets[0]->value;
+}
+
+size_t RadixHeapGetLength(const RadixHeap *heap){
+    if(heap == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] RadixHeapGetLength failed. RadixHeap value is NULL.\n");
+        #endif
+        return -1;
+    }
+
+    return heap->length;
+}
+
+STD_DDS_RESULT RadixHeapFree(RadixHeap *heap){
+    if(heap == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] RadixHeapFree failed. RadixHeap value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    NodePoolFree(heap->pool);
+    free(heap);
+
+    return STD_DDS_SUCCESS;
+}
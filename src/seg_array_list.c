@@ -0,0 +1,265 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "seg_array_list.h"
+#include "std_dds_core.h"
+#include "std_dds_inline.h"
+
+#if defined(STD_DDS_WARNING_MSG) && !defined(STD_DDS_ERROR_MSG)
+    #define STD_DDS_ERROR_MSG
+#endif
+
+#include <stdlib.h>
+#if defined(STD_DDS_ERROR_MSG) || defined(STD_DDS_WARNING_MSG)
+    #include <stdio.h>
+#endif
+
+SegArrayList *SegArrayListInit(const size_t blockCapacity) {
+    if (blockCapacity == 0 || (blockCapacity & (blockCapacity - 1)) != 0) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] SegArrayListInit failed. Block capacity '%zu' is not a power of two.\n", blockCapacity);
+        #endif
+        return NULL;
+    }
+
+    SegArrayList *list = (SegArrayList *)malloc(sizeof(SegArrayList));
+    if (list == NULL) {
+        #ifdef STD_DDS_ERROR_MSG
+            fprintf(stderr, "[Error] SegArrayList malloc failed. Unable to allocate memory of %zu bytes.\n", sizeof(SegArrayList));
+        #endif
+        return NULL;
+    }
+
+    list->blocks = NULL;
+    list->blockLength = 0;
+    list->directoryCapacity = 0;
+    list->length = 0;
+    list->blockMask = blockCapacity - 1;
+    list->blockShift = 0;
+    while (((size_t)1 << list->blockShift) < blockCapacity) {
+        list->blockShift++;
+    }
+
+    return list;
+}
+
+/**
+ * Allocate one more block, growing the directory if it is full.
+ * Only the directory of block pointers is ever reallocated.
+**/
+static STD_DDS_RESULT segArrayListAddBlock(SegArrayList *list) {
+    if (list->blockLength >= list->directoryCapacity) {
+        size_t capacity = list->directoryCapacity == 0 ? 4 : list->directoryCapacity * 2;
+
+        void ***blocks = realloc(list->blocks, sizeof(void **) * capacity);
+        if (blocks == NULL) {
+            #ifdef STD_DDS_ERROR_MSG
+                fprintf(stderr, "[Error] SegArrayList directory realloc failed. Unable to reallocate memory of %zu bytes.\n", sizeof(void **) * capacity);
+            #endif
+            return STD_DDS_REALLOC_FAILED;
+        }
+
+        list->blocks = blocks;
+        list->directoryCapacity = capacity;
+    }
+
+    void **block = malloc(sizeof(void *) << list->blockShift);
+    if (block == NULL) {
+        #ifdef STD_DDS_ERROR_MSG
+            fprintf(stderr, "[Error] SegArrayList block malloc failed. Unable to allocate memory of %zu bytes.\n", sizeof(void *) << list->blockShift);
+        #endif
+        return STD_DDS_MALLOC_FAILED;
+    }
+
+    list->blocks[list->blockLength] = block;
+    list->blockLength++;
+
+    return STD_DDS_SUCCESS;
+}
+
+STD_DDS_RESULT SegArrayListReserve(SegArrayList *list, const size_t capacity) {
+    if (list == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] SegArrayListReserve failed. SegArrayList value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    while ((list->blockLength << list->blockShift) < capacity) {
+        STD_DDS_RESULT result = segArrayListAddBlock(list);
+        if (result != STD_DDS_SUCCESS) {
+            return result;
+        }
+    }
+
+    return STD_DDS_SUCCESS;
+}
+
+void *SegArrayListGetAt(const SegArrayList *list, const size_t index) {
+    if (list == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] SegArrayListGetAt failed. SegArrayList value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    if (index >= list->length) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] Index '%zu' is out-of-bounds for SegArrayList with a length of '%zu'.\n", index, list->length);
+        #endif
+        return NULL;
+    }
+
+    return list->blocks[index >> list->blockShift][index & list->blockMask];
+}
+
+void **SegArrayListGetRefAt(SegArrayList *list, const size_t index) {
+    if (list == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] SegArrayListGetRefAt failed. SegArrayList value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    if (index >= list->length) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] Index '%zu' is out-of-bounds for SegArrayList with a length of '%zu'.\n", index, list->length);
+        #endif
+        return NULL;
+    }
+
+    return &list->blocks[index >> list->blockShift][index & list->blockMask];
+}
+
+STD_DDS_RESULT SegArrayListSetAt(SegArrayList *list, const size_t index, void *value) {
+    if (list == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] SegArrayListSetAt failed. SegArrayList value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if (index >= list->length) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] Index '%zu' is out-of-bounds for SegArrayList with a length of '%zu'.\n", index, list->length);
+        #endif
+        return STD_DDS_OUT_OF_BOUNDS;
+    }
+
+    list->blocks[index >> list->blockShift][index & list->blockMask] = value;
+
+    return STD_DDS_SUCCESS;
+}
+
+STD_DDS_RESULT SegArrayListAppend(SegArrayList *list, void *value) {
+    if (list == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] SegArrayListAppend failed. SegArrayList value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if ((list->length >> list->blockShift) >= list->blockLength) {
+        STD_DDS_RESULT result = segArrayListAddBlock(list);
+        if (result != STD_DDS_SUCCESS) {
+            return result;
+        }
+    }
+
+    list->blocks[list->length >> list->blockShift][list->length & list->blockMask] = value;
+    list->length++;
+
+    return STD_DDS_SUCCESS;
+}
+
+void *SegArrayListPop(SegArrayList *list) {
+    if (list == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] SegArrayListPop failed. SegArrayList value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    if (list->length <= 0) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] Unable to pop SegArrayList as its current length is 0.\n");
+        #endif
+        return NULL;
+    }
+
+    list->length--;
+
+    return list->blocks[list->length >> list->blockShift][list->length & list->blockMask];
+}
+
+STD_DDS_RESULT SegArrayListShrinkToFit(SegArrayList *list) {
+    if (list == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] SegArrayListShrinkToFit failed. SegArrayList value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    size_t blocksNeeded = (list->length + list->blockMask) >> list->blockShift;
+
+    while (list->blockLength > blocksNeeded) {
+        list->blockLength--;
+        free(list->blocks[list->blockLength]);
+    }
+
+    return STD_DDS_SUCCESS;
+}
+
+size_t SegArrayListGetLength(const SegArrayList *list) {
+    if (list == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] SegArrayListGetLength failed. SegArrayList value is NULL.\n");
+        #endif
+        return -1;
+    }
+
+    return list->length;
+}
+
+size_t SegArrayListGetCapacity(const SegArrayList *list) {
+    if (list == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] SegArrayListGetCapacity failed. SegArrayList value is NULL.\n");
+        #endif
+        return -1;
+    }
+
+    return list->blockLength << list->blockShift;
+}
+
+STD_DDS_RESULT SegArrayListFree(SegArrayList *list) {
+    if (list == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] SegArrayListFree failed. SegArrayList value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    for (size_t i = 0; i < list->blockLength; i++) {
+        free(list->blocks[i]);
+    }
+
+    free(list->blocks);
+
+    free(list);
+
+    return STD_DDS_SUCCESS;
+}
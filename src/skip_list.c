@@ -0,0 +1,433 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "skip_list.h"
+#include "std_dds_core.h"
+#include "epoch.h"
+
+#if defined(STD_DDS_WARNING_MSG) && !defined(STD_DDS_ERROR_MSG)
+    #define STD_DDS_ERROR_MSG
+#endif
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#if defined(STD_DDS_ERROR_MSG) || defined(STD_DDS_WARNING_MSG)
+    #include <stdio.h>
+#endif
+
+/* The low bit of a next link marks its node as removed from that level.
+   refs starts at 2: one reference is dropped by the inserting thread once it
+   stops linking upper levels, the other by the thread that removes the node.
+   Whichever drops the last reference retires the node. */
+typedef struct skipNode {
+    void *key;
+    void *value;
+    atomic_int refs;
+    int topLevel;
+    _Atomic(uintptr_t) next[];
+} SkipNode;
+
+struct skipList {
+    int (*compare)(const void *a, const void *b);
+    atomic_size_t length;
+    SkipNode *head;
+};
+
+#define SKIP_LIST_MARK ((uintptr_t)1)
+
+static inline SkipNode *skipListPtr(uintptr_t link){
+    return (SkipNode *)(link & ~SKIP_LIST_MARK);
+}
+
+static inline int skipListMarked(uintptr_t link){
+    return (link & SKIP_LIST_MARK) != 0;
+}
+
+static SkipNode *skipNodeInit(void *key, void *value, int topLevel){
+    size_t bytes = sizeof(SkipNode) + sizeof(_Atomic(uintptr_t)) * topLevel;
+    SkipNode *node = (SkipNode *)malloc(bytes);
+    if(node == NULL){
+        #ifdef STD_DDS_ERROR_MSG
+            fprintf(stderr, "[Error] SkipNode malloc failed. Unable to allocate memory of %zu bytes.\n", bytes);
+        #endif
+        return NULL;
+    }
+
+    node->key = key;
+    node->value = value;
+    atomic_init(&node->refs, 2);
+    node->topLevel = topLevel;
+    for(int level = 0; level < topLevel; level++){
+        atomic_init(&node->next[level], 0);
+    }
+
+    return node;
+}
+
+static void skipNodeRelease(SkipNode *node){
+    if(atomic_fetch_sub(&node->refs, 1) == 1){
+        EpochRetire(node, free);
+    }
+}
+
+// Each level above the first is kept with probability 1/2.
+static int skipListRandomLevel(void){
+    static _Thread_local uint64_t seed = 0;
+    if(seed == 0){
+        seed = (uint64_t)(uintptr_t)&seed ^ 0x9E3779B97F4A7C15ull;
+    }
+
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+
+    int level = 1;
+    uint64_t bits = seed;
+    while((bits & 1) && level < STD_DDS_SKIP_LIST_MAX_LEVEL){
+        level++;
+        bits >>= 1;
+    }
+
+    return level;
+}
+
+/* Find the last node before key (preds) and the first node at or after key
+   (succs) on every level, unlinking marked nodes on the way. Restarts from the
+   head whenever an unlink fails because a predecessor changed. */
+static int skipListFind(const SkipList *list, const void *key, SkipNode **preds, SkipNode **succs){
+    int restart;
+
+    do {
+        restart = 0;
+        SkipNode *pred = list->head;
+
+        for(int level = STD_DDS_SKIP_LIST_MAX_LEVEL - 1; level >= 0 && !restart; level--){
+            SkipNode *curr = skipListPtr(atomic_load(&pred->next[level]));
+
+            while(curr != NULL){
+                uintptr_t succ = atomic_load(&curr->next[level]);
+
+                if(skipListMarked(succ)){
+                    uintptr_t expected = (uintptr_t)curr;
+                    if(!atomic_compare_exchange_strong(&pred->next[level], &expected, succ & ~SKIP_LIST_MARK)){
+                        restart = 1;
+                        break;
+                    }
+                    curr = skipListPtr(succ);
+                    continue;
+                }
+
+                if(list->compare(curr->key, key) >= 0){
+                    break;
+                }
+
+                pred = curr;
+                curr = skipListPtr(succ);
+            }
+
+            preds[level] = pred;
+            succs[level] = curr;
+        }
+    } while(restart);
+
+    return succs[0] != NULL && list->compare(succs[0]->key, key) == 0;
+}
+
+// Find the first unmarked node at or after key without unlinking anything.
+static SkipNode *skipListSeek(const SkipList *list, const void *key){
+    SkipNode *pred = list->head;
+    SkipNode *curr = NULL;
+
+    for(int level = STD_DDS_SKIP_LIST_MAX_LEVEL - 1; level >= 0; level--){
+        curr = skipListPtr(atomic_load(&pred->next[level]));
+
+        while(curr != NULL){
+            uintptr_t succ = atomic_load(&curr->next[level]);
+
+            if(skipListMarked(succ)){
+                curr = skipListPtr(succ);
+                continue;
+            }
+
+            if(key == NULL || list->compare(curr->key, key) >= 0){
+                break;
+            }
+
+            pred = curr;
+            curr = skipListPtr(succ);
+        }
+    }
+
+    return curr;
+}
+
+SkipList *SkipListInit(int (*compare)(const void *a, const void *b)){
+    if(compare == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] SkipListInit failed. Compare function is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    SkipList *list = (SkipList *)malloc(sizeof(SkipList));
+    if(list == NULL){
+        #ifdef STD_DDS_ERROR_MSG
+            fprintf(stderr, "[Error] SkipList malloc failed. Unable to allocate memory of %zu bytes.\n", sizeof(SkipList));
+        #endif
+        return NULL;
+    }
+
+    list->head = skipNodeInit(NULL, NULL, STD_DDS_SKIP_LIST_MAX_LEVEL);
+    if(list->head == NULL){
+        free(list);
+        return NULL;
+    }
+
+    list->compare = compare;
+    atomic_init(&list->length, 0);
+
+    return list;
+}
+
+STD_DDS_RESULT SkipListInsert(SkipList *list, void *key, void *value){
+    if(list == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] SkipListInsert failed. SkipList value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    STD_DDS_RESULT result = EpochEnter();
+    if(result != STD_DDS_SUCCESS){
+        return result;
+    }
+
+    SkipNode *preds[STD_DDS_SKIP_LIST_MAX_LEVEL];
+    SkipNode *succs[STD_DDS_SKIP_LIST_MAX_LEVEL];
+    int topLevel = skipListRandomLevel();
+    SkipNode *node = NULL;
+
+    // Linking the bottom level is the linearisation point of the insert.
+    for(;;){
+        if(skipListFind(list, key, preds, succs)){
+            free(node);
+            EpochExit();
+            return STD_DDS_DUPLICATE_VALUE;
+        }
+
+        if(node == NULL){
+            node = skipNodeInit(key, value, topLevel);
+            if(node == NULL){
+                EpochExit();
+                return STD_DDS_MALLOC_FAILED;
+            }
+        }
+
+        for(int level = 0; level < topLevel; level++){
+            atomic_store_explicit(&node->next[level], (uintptr_t)succs[level], memory_order_relaxed);
+        }
+
+        uintptr_t expected = (uintptr_t)succs[0];
+        if(atomic_compare_exchange_strong(&preds[0]->next[0], &expected, (uintptr_t)node)){
+            break;
+        }
+    }
+
+    atomic_fetch_add(&list->length, 1);
+
+    // Link the upper levels, giving up once the node has been marked for removal.
+    int removed = 0;
+    for(int level = 1; level < topLevel && !removed; level++){
+        for(;;){
+            uintptr_t link = atomic_load(&node->next[level]);
+            if(skipListMarked(link)){
+                removed = 1;
+                break;
+            }
+
+            if(skipListPtr(link) != succs[level] &&
+                !atomic_compare_exchange_strong(&node->next[level], &link, (uintptr_t)succs[level])){
+                continue;
+            }
+
+            uintptr_t expected = (uintptr_t)succs[level];
+            if(atomic_compare_exchange_strong(&preds[level]->next[level], &expected, (uintptr_t)node)){
+                break;
+            }
+
+            skipListFind(list, key, preds, succs);
+            if(succs[0] != node){
+                removed = 1;
+                break;
+            }
+        }
+    }
+
+    // A remover may have finished unlinking before a level was linked above, unlink it again.
+    if(skipListMarked(atomic_load(&node->next[0]))){
+        skipListFind(list, key, preds, succs);
+    }
+
+    skipNodeRelease(node);
+    EpochExit();
+
+    return STD_DDS_SUCCESS;
+}
+
+void *SkipListGet(const SkipList *list, const void *key){
+    if(list == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] SkipListGet failed. SkipList value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    if(EpochEnter() != STD_DDS_SUCCESS){
+        return NULL;
+    }
+
+    void *value = NULL;
+    SkipNode *node = skipListSeek(list, key);
+    if(node != NULL && list->compare(node->key, key) == 0){
+        value = node->value;
+    }
+
+    EpochExit();
+
+    return value;
+}
+
+void *SkipListRemove(SkipList *list, const void *key){
+    if(list == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] SkipListRemove failed. SkipList value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    if(EpochEnter() != STD_DDS_SUCCESS){
+        return NULL;
+    }
+
+    SkipNode *preds[STD_DDS_SKIP_LIST_MAX_LEVEL];
+    SkipNode *succs[STD_DDS_SKIP_LIST_MAX_LEVEL];
+
+    if(!skipListFind(list, key, preds, succs)){
+        EpochExit();
+        return NULL;
+    }
+
+    SkipNode *node = succs[0];
+
+    for(int level = node->topLevel - 1; level > 0; level--){
+        uintptr_t link = atomic_load(&node->next[level]);
+        while(!skipListMarked(link) &&
+            !atomic_compare_exchange_weak(&node->next[level], &link, link | SKIP_LIST_MARK)){
+        }
+    }
+
+    // Marking the bottom level is the linearisation point, only one remover can win it.
+    uintptr_t link = atomic_load(&node->next[0]);
+    for(;;){
+        if(skipListMarked(link)){
+            EpochExit();
+            return NULL;
+        }
+
+        if(atomic_compare_exchange_weak(&node->next[0], &link, link | SKIP_LIST_MARK)){
+            break;
+        }
+    }
+
+    atomic_fetch_sub(&list->length, 1);
+    void *value = node->value;
+
+    skipListFind(list, key, preds, succs);
+    skipNodeRelease(node);
+    EpochExit();
+
+    return value;
+}
+
+size_t SkipListRange(const SkipList *list, const void *min, const void *max, int (*callback)(void *key, void *value, void *ctx), void *ctx){
+    if(list == NULL || callback == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] SkipListRange failed. SkipList or callback value is NULL.\n");
+        #endif
+        return -1;
+    }
+
+    if(EpochEnter() != STD_DDS_SUCCESS){
+        return 0;
+    }
+
+    size_t visited = 0;
+    SkipNode *node = skipListSeek(list, min);
+
+    while(node != NULL){
+        uintptr_t succ = atomic_load(&node->next[0]);
+
+        if(!skipListMarked(succ)){
+            if(max != NULL && list->compare(node->key, max) > 0){
+                break;
+            }
+
+            visited++;
+            if(callback(node->key, node->value, ctx) != 0){
+                break;
+            }
+        }
+
+        node = skipListPtr(succ);
+    }
+
+    EpochExit();
+
+    return visited;
+}
+
+size_t SkipListGetLength(const SkipList *list){
+    if(list == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] SkipListGetLength failed. SkipList value is NULL.\n");
+        #endif
+        return -1;
+    }
+
+    return atomic_load(&list->length);
+}
+
+STD_DDS_RESULT SkipListFree(SkipList *list){
+    if(list == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] SkipListFree failed. SkipList value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    SkipNode *node = list->head;
+    while(node != NULL){
+        SkipNode *next = skipListPtr(atomic_load(&node->next[0]));
+        free(node);
+        node = next;
+    }
+
+    free(list);
+
+    return STD_DDS_SUCCESS;
+}
@@ -0,0 +1,269 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "spsc_queue.h"
+#include "std_dds_core.h"
+
+#if defined(STD_DDS_WARNING_MSG) && !defined(STD_DDS_ERROR_MSG)
+    #define STD_DDS_ERROR_MSG
+#endif
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdatomic.h>
+#if defined(STD_DDS_ERROR_MSG) || defined(STD_DDS_WARNING_MSG)
+    #include <stdio.h>
+#endif
+
+/* Each index shares a cache line only with the cached copy of the other index
+   used by the same thread, so the producer and consumer only touch each
+   other's line when the queue looks full or empty. */
+struct spscQueue {
+    _Alignas(64) atomic_size_t tail;
+    size_t cachedHead;
+    _Alignas(64) atomic_size_t head;
+    size_t cachedTail;
+    _Alignas(64) size_t mask;
+    void **values;
+};
+
+// Copy n values into the ring starting at index, split in two at the wrap point.
+static void spscQueueCopyIn(SPSCQueue *queue, size_t index, void *const *values, size_t n){
+    size_t start = index & queue->mask;
+    size_t first = queue->mask + 1 - start < n ? queue->mask + 1 - start : n;
+
+    memcpy(queue->values + start, values, sizeof(void *) * first);
+    if(first < n){
+        memcpy(queue->values, values + first, sizeof(void *) * (n - first));
+    }
+}
+
+static void spscQueueCopyOut(const SPSCQueue *queue, size_t index, void **values, size_t n){
+    size_t start = index & queue->mask;
+    size_t first = queue->mask + 1 - start < n ? queue->mask + 1 - start : n;
+
+    memcpy(values, queue->values + start, sizeof(void *) * first);
+    if(first < n){
+        memcpy(values + first, queue->values, sizeof(void *) * (n - first));
+    }
+}
+
+SPSCQueue *SPSCQueueInit(const size_t capacity){
+    if(capacity == 0 || capacity > (SIZE_MAX / sizeof(void *)) / 2 + 1){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] SPSCQueueInit failed. A capacity of '%zu' elements is invalid.\n", capacity);
+        #endif
+        return NULL;
+    }
+
+    size_t rounded = 1;
+    while(rounded < capacity){
+        rounded *= 2;
+    }
+
+    SPSCQueue *queue = (SPSCQueue *)aligned_alloc(_Alignof(SPSCQueue), sizeof(SPSCQueue));
+    if(queue == NULL){
+        #ifdef STD_DDS_ERROR_MSG
+            fprintf(stderr, "[Error] SPSCQueue aligned_alloc failed. Unable to allocate memory of %zu bytes.\n", sizeof(SPSCQueue));
+        #endif
+        return NULL;
+    }
+
+    queue->values = (void **)malloc(sizeof(void *) * rounded);
+    if(queue->values == NULL){
+        #ifdef STD_DDS_ERROR_MSG
+            fprintf(stderr, "[Error] SPSCQueue values malloc failed. Unable to allocate memory of %zu bytes.\n", sizeof(void *) * rounded);
+        #endif
+        free(queue);
+        return NULL;
+    }
+
+    atomic_init(&queue->tail, 0);
+    atomic_init(&queue->head, 0);
+    queue->cachedHead = 0;
+    queue->cachedTail = 0;
+    queue->mask = rounded - 1;
+
+    return queue;
+}
+
+STD_DDS_RESULT SPSCQueueEnqueue(SPSCQueue *queue, void *value){
+    if(queue == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] SPSCQueueEnqueue failed. SPSCQueue value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    if(tail - queue->cachedHead > queue->mask){
+        queue->cachedHead = atomic_load_explicit(&queue->head, memory_order_acquire);
+        if(tail - queue->cachedHead > queue->mask){
+            return STD_DDS_FULL;
+        }
+    }
+
+    queue->values[tail & queue->mask] = value;
+    atomic_store_explicit(&queue->tail, tail + 1, memory_order_release);
+
+    return STD_DDS_SUCCESS;
+}
+
+size_t SPSCQueueEnqueueN(SPSCQueue *queue, void *const *values, const size_t n){
+    if(queue == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] SPSCQueueEnqueueN failed. SPSCQueue value is NULL.\n");
+        #endif
+        return -1;
+    }
+
+    if(values == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] SPSCQueueEnqueueN failed. Values array is NULL.\n");
+        #endif
+        return -1;
+    }
+
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    size_t space = queue->mask + 1 - (tail - queue->cachedHead);
+    if(space < n){
+        queue->cachedHead = atomic_load_explicit(&queue->head, memory_order_acquire);
+        space = queue->mask + 1 - (tail - queue->cachedHead);
+    }
+
+    size_t count = n < space ? n : space;
+    if(count == 0){
+        return 0;
+    }
+
+    spscQueueCopyIn(queue, tail, values, count);
+    atomic_store_explicit(&queue->tail, tail + count, memory_order_release);
+
+    return count;
+}
+
+void *SPSCQueueDequeue(SPSCQueue *queue){
+    if(queue == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] SPSCQueueDequeue failed. SPSCQueue value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    if(head == queue->cachedTail){
+        queue->cachedTail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+        if(head == queue->cachedTail){
+            return NULL;
+        }
+    }
+
+    void *value = queue->values[head & queue->mask];
+    atomic_store_explicit(&queue->head, head + 1, memory_order_release);
+
+    return value;
+}
+
+size_t SPSCQueueDequeueN(SPSCQueue *queue, void **values, const size_t n){
+    if(queue == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] SPSCQueueDequeueN failed. SPSCQueue value is NULL.\n");
+        #endif
+        return -1;
+    }
+
+    size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    size_t available = queue->cachedTail - head;
+    if(available < n){
+        queue->cachedTail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+        available = queue->cachedTail - head;
+    }
+
+    size_t count = n < available ? n : available;
+    if(count == 0){
+        return 0;
+    }
+
+    if(values != NULL){
+        spscQueueCopyOut(queue, head, values, count);
+    }
+    atomic_store_explicit(&queue->head, head + count, memory_order_release);
+
+    return count;
+}
+
+void *SPSCQueuePeek(SPSCQueue *queue){
+    if(queue == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] SPSCQueuePeek failed. SPSCQueue value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    if(head == queue->cachedTail){
+        queue->cachedTail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+        if(head == queue->cachedTail){
+            return NULL;
+        }
+    }
+
+    return queue->values[head & queue->mask];
+}
+
+size_t SPSCQueueGetLength(const SPSCQueue *queue){
+    if(queue == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] SPSCQueueGetLength failed. SPSCQueue value is NULL.\n");
+        #endif
+        return -1;
+    }
+
+    size_t head = atomic_load_explicit(&queue->head, memory_order_acquire);
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+
+    // head is read first so the difference never wraps below zero, but a stale
+    // head can make it exceed the capacity.
+    size_t length = tail - head;
+    return length > queue->mask + 1 ? queue->mask + 1 : length;
+}
+
+size_t SPSCQueueGetCapacity(const SPSCQueue *queue){
+    if(queue == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] SPSCQueueGetCapacity failed. SPSCQueue value is NULL.\n");
+        #endif
+        return -1;
+    }
+
+    return queue->mask + 1;
+}
+
+STD_DDS_RESULT SPSCQueueFree(SPSCQueue *queue){
+    if(queue == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] SPSCQueueFree failed. SPSCQueue value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    free(queue->values);
+    free(queue);
+
+    return STD_DDS_SUCCESS;
+}
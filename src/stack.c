@@ -17,22 +17,52 @@
 
 #include "stack.h"
 #include "std_dds_core.h"
+#include "std_dds_inline.h"
+#include "node_pool.h"
 
 #if defined(STD_DDS_WARNING_MSG) && !defined(STD_DDS_ERROR_MSG)
     #define STD_DDS_ERROR_MSG
 #endif
 
 #include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
 #if defined(STD_DDS_ERROR_MSG) || defined(STD_DDS_WARNING_MSG)
     #include <stdio.h>
 #endif
 
-typedef struct stack {
-    LinkedNode *head;
-    size_t length;
-} Stack;
+/**
+ * Grow the array of an array-backed Stack to fit at least minCapacity elements,
+ * doubling its capacity.
+**/
+static STD_DDS_RESULT stackGrow(Stack *stack, size_t minCapacity) {
+    if (minCapacity > SIZE_MAX / sizeof(void *)) {
+        #ifdef STD_DDS_ERROR_MSG
+            fprintf(stderr, "[Error] Stack capacity of '%zu' elements cannot grow further.\n", stack->capacity);
+        #endif
+        return STD_DDS_REALLOC_FAILED;
+    }
 
-Stack *StackInit() {
+    size_t capacity = stack->capacity < 4 ? 4 : stack->capacity;
+    while (capacity < minCapacity) {
+        capacity = capacity > SIZE_MAX / sizeof(void *) / 2 ? minCapacity : capacity * 2;
+    }
+
+    void **values = realloc(stack->values, sizeof(void *) * capacity);
+    if (values == NULL) {
+        #ifdef STD_DDS_ERROR_MSG
+            fprintf(stderr, "[Error] Stack values realloc failed. Unable to reallocate memory of %zu bytes.\n", sizeof(void *) * capacity);
+        #endif
+        return STD_DDS_REALLOC_FAILED;
+    }
+
+    stack->values = values;
+    stack->capacity = capacity;
+
+    return STD_DDS_SUCCESS;
+}
+
+static Stack *stackInit(int pooled, size_t slabLength) {
     Stack *stack = (Stack *)malloc(sizeof(Stack));
     if (stack == NULL) {
         #ifdef STD_DDS_ERROR_MSG
@@ -43,9 +73,45 @@ Stack *StackInit() {
   
     stack->head = NULL;
     stack->length = 0;
+    stack->pool = NULL;
+    stack->values = NULL;
+    stack->capacity = 0;
+    stack->arrayBacked = 0;
+
+    if (pooled) {
+        stack->pool = NodePoolInit(sizeof(LinkedNode), slabLength);
+        if (stack->pool == NULL) {
+            free(stack);
+            return NULL;
+        }
+    }
   
     return stack;
 }
+
+Stack *StackInit() {
+    return stackInit(0, 0);
+}
+
+Stack *StackInitPooled(const size_t slabLength) {
+    return stackInit(1, slabLength);
+}
+
+Stack *StackInitArray(const size_t capacity) {
+    Stack *stack = stackInit(0, 0);
+    if (stack == NULL) {
+        return NULL;
+    }
+
+    stack->arrayBacked = 1;
+
+    if (capacity > 0 && stackGrow(stack, capacity) != STD_DDS_SUCCESS) {
+        free(stack);
+        return NULL;
+    }
+
+    return stack;
+}
   
 STD_DDS_RESULT StackPush(Stack *stack, void *value) {
     if (stack == NULL) {
@@ -54,8 +120,30 @@ STD_DDS_RESULT StackPush(Stack *stack, void *value) {
         #endif
         return STD_DDS_NULL_PARAM;
     }
+
+    if (stack->arrayBacked) {
+        if (stack->length == stack->capacity) {
+            STD_DDS_RESULT result = stackGrow(stack, stack->length + 1);
+            if (result != STD_DDS_SUCCESS) {
+                return result;
+            }
+        }
+
+        stack->values[stack->length++] = value;
+
+        return STD_DDS_SUCCESS;
+    }
   
-    LinkedNode *node = LinkedNodeInit(value);
+    LinkedNode *node;
+    if (stack->pool != NULL) {
+        node = (LinkedNode *)NodePoolAlloc(stack->pool);
+        if (node != NULL) {
+            node->value = value;
+        }
+    } else {
+        node = LinkedNodeInit(value);
+    }
+
     if(node == NULL){
         return STD_DDS_MALLOC_FAILED;
     }
@@ -76,25 +164,125 @@ void *StackPop(Stack *stack) {
         return NULL;
     }
   
-    LinkedNode *node = stack->head;
-  
-    if(node == NULL || stack->length < 1){
+    if (stack->length < 1) {
         #ifdef STD_DDS_WARNING_MSG
             fprintf(stderr, "[Warning] Unable to pop element from Stack as its current length is 0.\n");
         #endif
         return NULL;
     }
+
+    if (stack->arrayBacked) {
+        return stack->values[--stack->length];
+    }
+
+    LinkedNode *node = stack->head;
   
     stack->head = node->next;
     stack->length--;
   
     void *value = node->value;
   
-    free(node);
+    if (stack->pool != NULL) {
+        NodePoolRelease(stack->pool, node);
+    } else {
+        free(node);
+    }
   
     return value;
 }
 
+STD_DDS_RESULT StackPushN(Stack *stack, void *const *values, const size_t n) {
+    if (stack == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] StackPushN failed. Stack value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if (values == NULL && n > 0) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] StackPushN failed. Values array is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if (!stack->arrayBacked) {
+        for (size_t i = 0; i < n; i++) {
+            STD_DDS_RESULT result = StackPush(stack, values[i]);
+            if (result != STD_DDS_SUCCESS) {
+                return result;
+            }
+        }
+
+        return STD_DDS_SUCCESS;
+    }
+
+    if (n > SIZE_MAX - stack->length) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] StackPushN failed. Pushing '%zu' elements would overflow the Stack's length.\n", n);
+        #endif
+        return STD_DDS_INVALID_PARAM;
+    }
+
+    if (stack->length + n > stack->capacity) {
+        STD_DDS_RESULT result = stackGrow(stack, stack->length + n);
+        if (result != STD_DDS_SUCCESS) {
+            return result;
+        }
+    }
+
+    if (n > 0) {
+        memcpy(stack->values + stack->length, values, sizeof(void *) * n);
+    }
+    stack->length += n;
+
+    return STD_DDS_SUCCESS;
+}
+
+size_t StackPopN(Stack *stack, void **values, const size_t n) {
+    if (stack == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] StackPopN failed. Stack value is NULL.\n");
+        #endif
+        return -1;
+    }
+
+    size_t count = n < stack->length ? n : stack->length;
+
+    if (stack->arrayBacked) {
+        stack->length -= count;
+        if (values != NULL && count > 0) {
+            memcpy(values, stack->values + stack->length, sizeof(void *) * count);
+        }
+
+        return count;
+    }
+
+    for (size_t i = count; i > 0; i--) {
+        void *value = StackPop(stack);
+        if (values != NULL) {
+            values[i - 1] = value;
+        }
+    }
+
+    return count;
+}
+
+void *StackPeek(const Stack *stack) {
+    if (stack == NULL) {
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] StackPeek failed. Stack value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    if (stack->length < 1) {
+        return NULL;
+    }
+
+    return stack->arrayBacked ? stack->values[stack->length - 1] : stack->head->value;
+}
+
 size_t StackGetLength(const Stack *stack){
     if(stack == NULL){
         #ifdef STD_DDS_WARNING_MSG
@@ -125,11 +313,17 @@ STD_DDS_RESULT StackFree(Stack *stack) {
         return STD_DDS_NULL_PARAM;
     }
   
-    LinkedNode *node = stack->head;
-    while(node != NULL){
-        LinkedNode *next = node->next;
-        free(node);
-        node = next;
+    if (stack->arrayBacked) {
+        free(stack->values);
+    } else if (stack->pool != NULL) {
+        NodePoolFree(stack->pool);
+    } else {
+        LinkedNode *node = stack->head;
+        while(node != NULL){
+            LinkedNode *next = node->next;
+            free(node);
+            node = next;
+        }
     }
   
     free(stack);
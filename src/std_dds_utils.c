@@ -31,12 +31,18 @@ void PrintResultCode(STD_DDS_RESULT result){
         case STD_DDS_NULL_PARAM:
             printf("[%d] STD_DDS_NULL_PARAM\n", result);
             break;
+        case STD_DDS_INVALID_PARAM:
+            printf("[%d] STD_DDS_INVALID_PARAM\n", result);
+            break;
         case STD_DDS_OUT_OF_BOUNDS:
             printf("[%d] STD_DDS_OUT_OF_BOUNDS\n", result);
             break;
         case STD_DDS_NOT_FOUND:
             printf("[%d] STD_DDS_NOT_FOUND\n", result);
             break;
+        case STD_DDS_FULL:
+            printf("[%d] STD_DDS_FULL\n", result);
+            break;
         case STD_DDS_DUPLICATE_VALUE:
             printf("[%d] STD_DDS_DUPLICATE_VALUE\n", result);
             break;
@@ -49,5 +55,8 @@ void PrintResultCode(STD_DDS_RESULT result){
         case STD_DDS_REALLOC_FAILED:
             printf("[%d] STD_DDS_REALLOC_FAILED\n", result);
             break;
+        case STD_DDS_IO_FAILED:
+            printf("[%d] STD_DDS_IO_FAILED\n", result);
+            break;
     }
 }
@@ -0,0 +1,291 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "timing_wheel.h"
+#include "std_dds_core.h"
+#include "intrusive_list.h"
+
+#if defined(STD_DDS_WARNING_MSG) && !defined(STD_DDS_ERROR_MSG)
+    #define STD_DDS_ERROR_MSG
+#endif
+
+#include <stdlib.h>
+#if defined(STD_DDS_ERROR_MSG) || defined(STD_DDS_WARNING_MSG)
+    #include <stdio.h>
+#endif
+
+#define TIMING_WHEEL_SLOTS (1ULL << STD_DDS_TIMING_WHEEL_SLOT_BITS)
+#define TIMING_WHEEL_SLOT_MASK (TIMING_WHEEL_SLOTS - 1)
+#define TIMING_WHEEL_RANGE_BITS (STD_DDS_TIMING_WHEEL_SLOT_BITS * STD_DDS_TIMING_WHEEL_LEVELS)
+
+_Static_assert(STD_DDS_TIMING_WHEEL_SLOT_BITS > 0 && STD_DDS_TIMING_WHEEL_LEVELS > 0,
+    "STD_DDS_TIMING_WHEEL_SLOT_BITS and STD_DDS_TIMING_WHEEL_LEVELS must be positive");
+_Static_assert(TIMING_WHEEL_RANGE_BITS < 64,
+    "STD_DDS_TIMING_WHEEL_SLOT_BITS * STD_DDS_TIMING_WHEEL_LEVELS must be below 64");
+
+/* A timer at level l sits in the slot its expiry falls in at that level's
+   resolution. Level l slot s is emptied into the levels below whenever now
+   enters the span of ticks it covers, which for a timer less than
+   SLOTS^(l + 1) ticks away is exactly the span holding its expiry. */
+struct timingWheel {
+    unsigned long long now;
+    size_t length;
+    IntrusiveList slots[STD_DDS_TIMING_WHEEL_LEVELS][TIMING_WHEEL_SLOTS];
+};
+
+// File a timer into the slot matching its expiry. Timers expiring on the
+// current tick go into the level 0 slot about to be fired.
+static void timingWheelFile(TimingWheel *wheel, WheelTimer *timer){
+    unsigned long long expiry = timer->expiry;
+    unsigned long long delta = expiry > wheel->now ? expiry - wheel->now : 0;
+
+    if(delta >> TIMING_WHEEL_RANGE_BITS){
+        expiry = wheel->now + (1ULL << TIMING_WHEEL_RANGE_BITS) - 1;
+        delta = expiry - wheel->now;
+    }
+
+    size_t level = 0;
+    while(level + 1 < STD_DDS_TIMING_WHEEL_LEVELS && (delta >> (STD_DDS_TIMING_WHEEL_SLOT_BITS * (level + 1))) != 0){
+        level++;
+    }
+
+    unsigned long long tick = delta == 0 ? wheel->now : expiry;
+    size_t slot = (size_t)((tick >> (STD_DDS_TIMING_WHEEL_SLOT_BITS * level)) & TIMING_WHEEL_SLOT_MASK);
+
+    timer->slot = &wheel->slots[level][slot];
+    IntrusiveListAppend(timer->slot, &timer->hook);
+}
+
+// Re-file every timer of a slot, each lands at a lower level.
+static void timingWheelCascade(TimingWheel *wheel, size_t level){
+    size_t slot = (size_t)((wheel->now >> (STD_DDS_TIMING_WHEEL_SLOT_BITS * level)) & TIMING_WHEEL_SLOT_MASK);
+    IntrusiveList *list = &wheel->slots[level][slot];
+
+    DLinkedHook *hook;
+    while((hook = IntrusiveListPop(list)) != NULL){
+        timingWheelFile(wheel, STD_DDS_CONTAINER_OF(hook, WheelTimer, hook));
+    }
+}
+
+// Advance by one tick and fire the timers due on it.
+static size_t timingWheelTick(TimingWheel *wheel){
+    wheel->now++;
+
+    // Empty the highest level whose span just began first, so its timers can
+    // still be caught by the cascades below it.
+    size_t levels = 0;
+    while(levels + 1 < STD_DDS_TIMING_WHEEL_LEVELS && (wheel->now & ((1ULL << (STD_DDS_TIMING_WHEEL_SLOT_BITS * (levels + 1))) - 1)) == 0){
+        levels++;
+    }
+    for(size_t level = levels; level > 0; level--){
+        timingWheelCascade(wheel, level);
+    }
+
+    IntrusiveList *slot = &wheel->slots[0][wheel->now & TIMING_WHEEL_SLOT_MASK];
+    if(slot->length == 0){
+        return 0;
+    }
+
+    // Take the whole slot as one batch so callbacks may reschedule into it.
+    IntrusiveList batch = *slot;
+    IntrusiveListInit(slot);
+
+    STD_DDS_INTRUSIVE_LIST_FOR_EACH(&batch, hook){
+        STD_DDS_CONTAINER_OF(hook, WheelTimer, hook)->slot = &batch;
+    }
+
+    size_t fired = 0;
+    DLinkedHook *hook;
+    while((hook = IntrusiveListPop(&batch)) != NULL){
+        WheelTimer *timer = STD_DDS_CONTAINER_OF(hook, WheelTimer, hook);
+        timer->slot = NULL;
+        wheel->length--;
+        fired++;
+
+        timer->callback(timer);
+    }
+
+    return fired;
+}
+
+STD_DDS_RESULT WheelTimerInit(WheelTimer *timer, void (*callback)(WheelTimer *timer)){
+    if(timer == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] WheelTimerInit failed. WheelTimer value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if(callback == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] WheelTimerInit failed. Callback function is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    timer->hook.prev = NULL;
+    timer->hook.next = NULL;
+    timer->expiry = 0;
+    timer->slot = NULL;
+    timer->callback = callback;
+
+    return STD_DDS_SUCCESS;
+}
+
+int WheelTimerIsScheduled(const WheelTimer *timer){
+    if(timer == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] WheelTimerIsScheduled failed. WheelTimer value is NULL.\n");
+        #endif
+        return -1;
+    }
+
+    return timer->slot != NULL;
+}
+
+TimingWheel *TimingWheelInit(const unsigned long long now){
+    TimingWheel *wheel = (TimingWheel *)malloc(sizeof(TimingWheel));
+    if(wheel == NULL){
+        #ifdef STD_DDS_ERROR_MSG
+            fprintf(stderr, "[Error] TimingWheel malloc failed. Unable to allocate memory of %zu bytes.\n", sizeof(TimingWheel));
+        #endif
+        return NULL;
+    }
+
+    wheel->now = now;
+    wheel->length = 0;
+
+    for(size_t level = 0; level < STD_DDS_TIMING_WHEEL_LEVELS; level++){
+        for(size_t slot = 0; slot < TIMING_WHEEL_SLOTS; slot++){
+            IntrusiveListInit(&wheel->slots[level][slot]);
+        }
+    }
+
+    return wheel;
+}
+
+STD_DDS_RESULT TimingWheelSchedule(TimingWheel *wheel, WheelTimer *timer, const unsigned long long delay){
+    if(wheel == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] TimingWheelSchedule failed. TimingWheel value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if(timer == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] TimingWheelSchedule failed. WheelTimer value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if(timer->slot != NULL){
+        IntrusiveListRemove(timer->slot, &timer->hook);
+        wheel->length--;
+    }
+
+    unsigned long long ticks = delay == 0 ? 1 : delay;
+    timer->expiry = ticks > ~0ULL - wheel->now ? ~0ULL : wheel->now + ticks;
+
+    timingWheelFile(wheel, timer);
+    wheel->length++;
+
+    return STD_DDS_SUCCESS;
+}
+
+STD_DDS_RESULT TimingWheelCancel(TimingWheel *wheel, WheelTimer *timer){
+    if(wheel == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] TimingWheelCancel failed. TimingWheel value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if(timer == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] TimingWheelCancel failed. WheelTimer value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if(timer->slot == NULL){
+        return STD_DDS_NOT_FOUND;
+    }
+
+    IntrusiveListRemove(timer->slot, &timer->hook);
+    timer->slot = NULL;
+    wheel->length--;
+
+    return STD_DDS_SUCCESS;
+}
+
+size_t TimingWheelAdvance(TimingWheel *wheel, const unsigned long long ticks){
+    if(wheel == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] TimingWheelAdvance failed. TimingWheel value is NULL.\n");
+        #endif
+        return -1;
+    }
+
+    size_t fired = 0;
+    for(unsigned long long remaining = ticks; remaining > 0; remaining--){
+        // Nothing left to fire or re-file, skip straight to the end.
+        if(wheel->length == 0){
+            wheel->now += remaining;
+            break;
+        }
+
+        fired += timingWheelTick(wheel);
+    }
+
+    return fired;
+}
+
+unsigned long long TimingWheelGetNow(const TimingWheel *wheel){
+    if(wheel == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] TimingWheelGetNow failed. TimingWheel value is NULL.\n");
+        #endif
+        return 0;
+    }
+
+    return wheel->now;
+}
+
+size_t TimingWheelGetLength(const TimingWheel *wheel){
+    if(wheel == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] TimingWheelGetLength failed. TimingWheel value is NULL.\n");
+        #endif
+        return -1;
+    }
+
+    return wheel->length;
+}
+
+STD_DDS_RESULT TimingWheelFree(TimingWheel *wheel){
+    if(wheel == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] TimingWheelFree failed. TimingWheel value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    free(wheel);
+
+    return STD_DDS_SUCCESS;
+}
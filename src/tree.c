@@ -55,7 +55,7 @@ TreeNode *TreeNodeInit(const char *key, void *value){
     strcpy(node->key, key);
 
     node->value = value;
-    node->children = ArrayListInit(4); 
+    node->children = ArrayListInitInline(4);
     if(node->children == NULL){
         free(node->key);
         free(node);
@@ -0,0 +1,323 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "unrolled_list.h"
+#include "std_dds_core.h"
+#include "std_dds_inline.h"
+
+#if defined(STD_DDS_WARNING_MSG) && !defined(STD_DDS_ERROR_MSG)
+    #define STD_DDS_ERROR_MSG
+#endif
+
+#include <stdlib.h>
+#if defined(STD_DDS_ERROR_MSG) || defined(STD_DDS_WARNING_MSG)
+    #include <stdio.h>
+#endif
+
+static UnrolledNode *unrolledNodeInit(const UnrolledList *list, const size_t start){
+    size_t bytes = sizeof(UnrolledNode) + sizeof(void *) * list->nodeCapacity;
+    UnrolledNode *node = (UnrolledNode *)malloc(bytes);
+    if(node == NULL){
+        #ifdef STD_DDS_ERROR_MSG
+            fprintf(stderr, "[Error] UnrolledNode malloc failed. Unable to allocate memory of %zu bytes.\n", bytes);
+        #endif
+        return NULL;
+    }
+
+    node->prev = NULL;
+    node->next = NULL;
+    node->start = start;
+    node->count = 0;
+
+    return node;
+}
+
+static void unrolledListUnlink(UnrolledList *list, UnrolledNode *node){
+    if(node->prev != NULL){
+        node->prev->next = node->next;
+    } else {
+        list->head = node->next;
+    }
+
+    if(node->next != NULL){
+        node->next->prev = node->prev;
+    } else {
+        list->tail = node->prev;
+    }
+
+    free(node);
+}
+
+// Find the node holding an index, skipping whole nodes from the closer end.
+static UnrolledNode *unrolledListFind(const UnrolledList *list, size_t index, size_t *offset){
+    UnrolledNode *node;
+
+    if(index < list->length / 2){
+        node = list->head;
+        while(index >= node->count){
+            index -= node->count;
+            node = node->next;
+        }
+    } else {
+        size_t fromTail = list->length - 1 - index;
+        node = list->tail;
+        while(fromTail >= node->count){
+            fromTail -= node->count;
+            node = node->prev;
+        }
+        index = node->count - 1 - fromTail;
+    }
+
+    *offset = node->start + index;
+    return node;
+}
+
+UnrolledList *UnrolledListInit(const size_t nodeCapacity){
+    UnrolledList *list = (UnrolledList *)malloc(sizeof(UnrolledList));
+    if(list == NULL){
+        #ifdef STD_DDS_ERROR_MSG
+            fprintf(stderr, "[Error] UnrolledList malloc failed. Unable to allocate memory of %zu bytes.\n", sizeof(UnrolledList));
+        #endif
+        return NULL;
+    }
+
+    list->head = NULL;
+    list->tail = NULL;
+    list->length = 0;
+    list->nodeCapacity = nodeCapacity == 0 ? STD_DDS_UNROLLED_LIST_NODE_CAPACITY : nodeCapacity;
+
+    return list;
+}
+
+STD_DDS_RESULT UnrolledListPush(UnrolledList *list, void *value){
+    if(list == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] UnrolledListPush failed. UnrolledList value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    UnrolledNode *node = list->head;
+
+    if(node == NULL || node->start == 0){
+        // Fill new head nodes from the back so further pushes stay in the same node.
+        node = unrolledNodeInit(list, list->nodeCapacity);
+        if(node == NULL){
+            return STD_DDS_MALLOC_FAILED;
+        }
+
+        node->next = list->head;
+        if(list->head != NULL){
+            list->head->prev = node;
+        } else {
+            list->tail = node;
+        }
+        list->head = node;
+    }
+
+    node->start--;
+    node->values[node->start] = value;
+    node->count++;
+    list->length++;
+
+    return STD_DDS_SUCCESS;
+}
+
+STD_DDS_RESULT UnrolledListAppend(UnrolledList *list, void *value){
+    if(list == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] UnrolledListAppend failed. UnrolledList value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    UnrolledNode *node = list->tail;
+
+    if(node == NULL || node->start + node->count == list->nodeCapacity){
+        node = unrolledNodeInit(list, 0);
+        if(node == NULL){
+            return STD_DDS_MALLOC_FAILED;
+        }
+
+        node->prev = list->tail;
+        if(list->tail != NULL){
+            list->tail->next = node;
+        } else {
+            list->head = node;
+        }
+        list->tail = node;
+    }
+
+    node->values[node->start + node->count] = value;
+    node->count++;
+    list->length++;
+
+    return STD_DDS_SUCCESS;
+}
+
+void *UnrolledListPop(UnrolledList *list){
+    if(list == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] UnrolledListPop failed. UnrolledList value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    UnrolledNode *node = list->head;
+
+    if(node == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] Unable to pop element from UnrolledList as its current length is 0.\n");
+        #endif
+        return NULL;
+    }
+
+    void *value = node->values[node->start];
+    node->start++;
+    node->count--;
+    list->length--;
+
+    if(node->count == 0){
+        unrolledListUnlink(list, node);
+    }
+
+    return value;
+}
+
+void *UnrolledListPopTail(UnrolledList *list){
+    if(list == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] UnrolledListPopTail failed. UnrolledList value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    UnrolledNode *node = list->tail;
+
+    if(node == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] Unable to pop tail element from UnrolledList as its current length is 0.\n");
+        #endif
+        return NULL;
+    }
+
+    node->count--;
+    void *value = node->values[node->start + node->count];
+    list->length--;
+
+    if(node->count == 0){
+        unrolledListUnlink(list, node);
+    }
+
+    return value;
+}
+
+void *UnrolledListGetAt(const UnrolledList *list, const size_t index){
+    if(list == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] UnrolledListGetAt failed. UnrolledList value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    if(index >= list->length){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] Index '%zu' is out-of-bounds for UnrolledList with a length of '%zu'.\n", index, list->length);
+        #endif
+        return NULL;
+    }
+
+    size_t offset;
+    UnrolledNode *node = unrolledListFind(list, index, &offset);
+
+    return node->values[offset];
+}
+
+STD_DDS_RESULT UnrolledListSetAt(UnrolledList *list, const size_t index, void *value){
+    if(list == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] UnrolledListSetAt failed. UnrolledList value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    if(index >= list->length){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] Index '%zu' is out-of-bounds for UnrolledList with a length of '%zu'.\n", index, list->length);
+        #endif
+        return STD_DDS_OUT_OF_BOUNDS;
+    }
+
+    size_t offset;
+    UnrolledNode *node = unrolledListFind(list, index, &offset);
+    node->values[offset] = value;
+
+    return STD_DDS_SUCCESS;
+}
+
+size_t UnrolledListGetLength(const UnrolledList *list){
+    if(list == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] UnrolledListGetLength failed. UnrolledList value is NULL.\n");
+        #endif
+        return -1;
+    }
+
+    return list->length;
+}
+
+UnrolledNode *UnrolledListGetHead(const UnrolledList *list){
+    if(list == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] UnrolledListGetHead failed. UnrolledList value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    return list->head;
+}
+
+UnrolledNode *UnrolledListGetTail(const UnrolledList *list){
+    if(list == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] UnrolledListGetTail failed. UnrolledList value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    return list->tail;
+}
+
+STD_DDS_RESULT UnrolledListFree(UnrolledList *list){
+    if(list == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] UnrolledListFree failed. UnrolledList value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    UnrolledNode *node = list->head;
+    while(node != NULL){
+        UnrolledNode *next = node->next;
+        free(node);
+        node = next;
+    }
+
+    free(list);
+
+    return STD_DDS_SUCCESS;
+}
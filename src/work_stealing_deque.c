@@ -0,0 +1,249 @@
+/* std_dds - Standard Dynamic Data Structures
+ * Copyright (C) 2025 Jasper Devir <jasperdevir.jd@gmail.com>
+ *
+ * std_dds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * std_dds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with std_dds.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "work_stealing_deque.h"
+#include "std_dds_core.h"
+#include "epoch.h"
+
+#if defined(STD_DDS_WARNING_MSG) && !defined(STD_DDS_ERROR_MSG)
+    #define STD_DDS_ERROR_MSG
+#endif
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#if defined(STD_DDS_ERROR_MSG) || defined(STD_DDS_WARNING_MSG)
+    #include <stdio.h>
+#endif
+
+/* The orderings follow "Correct and Efficient Work-Stealing for Weak Memory
+   Models" (Lê et al., 2013). top and bottom are signed so bottom - 1 on an
+   empty deque compares below top. */
+
+typedef struct workStealingArray {
+    size_t mask;
+    _Atomic(void *) values[];
+} WorkStealingArray;
+
+struct workStealingDeque {
+    _Alignas(64) atomic_ptrdiff_t top;
+    _Alignas(64) atomic_ptrdiff_t bottom;
+    _Atomic(WorkStealingArray *) array;
+};
+
+static WorkStealingArray *workStealingArrayInit(size_t capacity){
+    if(capacity > (SIZE_MAX - sizeof(WorkStealingArray)) / sizeof(void *)){
+        #ifdef STD_DDS_ERROR_MSG
+            fprintf(stderr, "[Error] WorkStealingDeque capacity of '%zu' elements cannot grow further.\n", capacity);
+        #endif
+        return NULL;
+    }
+
+    size_t size = sizeof(WorkStealingArray) + sizeof(void *) * capacity;
+    WorkStealingArray *array = (WorkStealingArray *)malloc(size);
+    if(array == NULL){
+        #ifdef STD_DDS_ERROR_MSG
+            fprintf(stderr, "[Error] WorkStealingDeque array malloc failed. Unable to allocate memory of %zu bytes.\n", size);
+        #endif
+        return NULL;
+    }
+
+    array->mask = capacity - 1;
+
+    return array;
+}
+
+// Copy the live range [top, bottom) into an array of twice the capacity and
+// publish it. Thieves may still be reading the old array, so it is retired.
+static WorkStealingArray *workStealingDequeGrow(WorkStealingDeque *deque, WorkStealingArray *array, ptrdiff_t top, ptrdiff_t bottom){
+    if(array->mask + 1 > SIZE_MAX / 2){
+        #ifdef STD_DDS_ERROR_MSG
+            fprintf(stderr, "[Error] WorkStealingDeque capacity of '%zu' elements cannot grow further.\n", array->mask + 1);
+        #endif
+        return NULL;
+    }
+
+    WorkStealingArray *grown = workStealingArrayInit((array->mask + 1) * 2);
+    if(grown == NULL){
+        return NULL;
+    }
+
+    for(ptrdiff_t i = top; i < bottom; i++){
+        void *value = atomic_load_explicit(&array->values[(size_t)i & array->mask], memory_order_relaxed);
+        atomic_store_explicit(&grown->values[(size_t)i & grown->mask], value, memory_order_relaxed);
+    }
+
+    atomic_store_explicit(&deque->array, grown, memory_order_release);
+
+    if(EpochEnter() == STD_DDS_SUCCESS){
+        EpochRetire(array, free);
+        EpochExit();
+    }
+
+    return grown;
+}
+
+WorkStealingDeque *WorkStealingDequeInit(const size_t capacity){
+    size_t rounded = 1;
+    size_t target = capacity == 0 ? 16 : capacity;
+    while(rounded < target){
+        if(rounded > SIZE_MAX / 2){
+            #ifdef STD_DDS_WARNING_MSG
+                fprintf(stderr, "[Warning] WorkStealingDequeInit failed. A capacity of '%zu' elements is invalid.\n", capacity);
+            #endif
+            return NULL;
+        }
+        rounded *= 2;
+    }
+
+    WorkStealingDeque *deque = (WorkStealingDeque *)aligned_alloc(_Alignof(WorkStealingDeque), sizeof(WorkStealingDeque));
+    if(deque == NULL){
+        #ifdef STD_DDS_ERROR_MSG
+            fprintf(stderr, "[Error] WorkStealingDeque aligned_alloc failed. Unable to allocate memory of %zu bytes.\n", sizeof(WorkStealingDeque));
+        #endif
+        return NULL;
+    }
+
+    WorkStealingArray *array = workStealingArrayInit(rounded);
+    if(array == NULL){
+        free(deque);
+        return NULL;
+    }
+
+    atomic_init(&deque->top, 0);
+    atomic_init(&deque->bottom, 0);
+    atomic_init(&deque->array, array);
+
+    return deque;
+}
+
+STD_DDS_RESULT WorkStealingDequePush(WorkStealingDeque *deque, void *value){
+    if(deque == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] WorkStealingDequePush failed. WorkStealingDeque value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    ptrdiff_t bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed);
+    ptrdiff_t top = atomic_load_explicit(&deque->top, memory_order_acquire);
+    WorkStealingArray *array = atomic_load_explicit(&deque->array, memory_order_relaxed);
+
+    if((size_t)(bottom - top) > array->mask){
+        array = workStealingDequeGrow(deque, array, top, bottom);
+        if(array == NULL){
+            return STD_DDS_MALLOC_FAILED;
+        }
+    }
+
+    atomic_store_explicit(&array->values[(size_t)bottom & array->mask], value, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+
+    return STD_DDS_SUCCESS;
+}
+
+void *WorkStealingDequePop(WorkStealingDeque *deque){
+    if(deque == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] WorkStealingDequePop failed. WorkStealingDeque value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    ptrdiff_t bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed) - 1;
+    WorkStealingArray *array = atomic_load_explicit(&deque->array, memory_order_relaxed);
+    atomic_store_explicit(&deque->bottom, bottom, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    ptrdiff_t top = atomic_load_explicit(&deque->top, memory_order_relaxed);
+
+    if(top > bottom){
+        atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+        return NULL;
+    }
+
+    void *value = atomic_load_explicit(&array->values[(size_t)bottom & array->mask], memory_order_relaxed);
+
+    if(top == bottom){
+        // Last element, race the thieves for it through top.
+        if(!atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1, memory_order_seq_cst, memory_order_relaxed)){
+            value = NULL;
+        }
+        atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+    }
+
+    return value;
+}
+
+void *WorkStealingDequeSteal(WorkStealingDeque *deque){
+    if(deque == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] WorkStealingDequeSteal failed. WorkStealingDeque value is NULL.\n");
+        #endif
+        return NULL;
+    }
+
+    if(EpochEnter() != STD_DDS_SUCCESS){
+        return NULL;
+    }
+
+    ptrdiff_t top = atomic_load_explicit(&deque->top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    ptrdiff_t bottom = atomic_load_explicit(&deque->bottom, memory_order_acquire);
+
+    void *value = NULL;
+    if(top < bottom){
+        // The epoch keeps an array outgrown by a concurrent push readable here.
+        WorkStealingArray *array = atomic_load_explicit(&deque->array, memory_order_acquire);
+        value = atomic_load_explicit(&array->values[(size_t)top & array->mask], memory_order_relaxed);
+        if(!atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1, memory_order_seq_cst, memory_order_relaxed)){
+            value = NULL;
+        }
+    }
+
+    EpochExit();
+
+    return value;
+}
+
+size_t WorkStealingDequeGetLength(const WorkStealingDeque *deque){
+    if(deque == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] WorkStealingDequeGetLength failed. WorkStealingDeque value is NULL.\n");
+        #endif
+        return -1;
+    }
+
+    ptrdiff_t top = atomic_load_explicit(&deque->top, memory_order_acquire);
+    ptrdiff_t bottom = atomic_load_explicit(&deque->bottom, memory_order_acquire);
+
+    return bottom > top ? (size_t)(bottom - top) : 0;
+}
+
+STD_DDS_RESULT WorkStealingDequeFree(WorkStealingDeque *deque){
+    if(deque == NULL){
+        #ifdef STD_DDS_WARNING_MSG
+            fprintf(stderr, "[Warning] WorkStealingDequeFree failed. WorkStealingDeque value is NULL.\n");
+        #endif
+        return STD_DDS_NULL_PARAM;
+    }
+
+    free(atomic_load_explicit(&deque->array, memory_order_relaxed));
+    free(deque);
+
+    return STD_DDS_SUCCESS;
+}